@@ -0,0 +1,120 @@
+#ifndef __BENCH_H
+#define __BENCH_H
+
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+
+//基准测试驱动
+//****************************************
+//每个bench_*.cpp用BENCH_CASE注册若干用例，bench_main.cpp统一运行
+//用例收到规模上限max_n，自行从10^3起按10倍递增到max_n，结果用report输出一行
+//编译：cl /O2 /EHsc /I..\my_STL bench_*.cpp ..\my_STL\__Alloc.cpp
+//运行：bench [max_n] [用例名前缀]，max_n默认10^7
+namespace bench
+{
+	typedef void(*case_function)(size_t max_n);
+
+	struct case_entry
+	{
+		const char *name;
+		case_function run;
+	};
+
+	enum
+	{
+		__MAX_CASES = 128
+	};
+
+	inline case_entry *cases()
+	{
+		static case_entry table[__MAX_CASES];
+		return table;
+	}
+
+	inline size_t &case_count()
+	{
+		static size_t n = 0;
+		return n;
+	}
+
+	struct registrar
+	{
+		registrar(const char *name, case_function f)
+		{
+			if (case_count() != __MAX_CASES)
+			{
+				case_entry e = { name, f };
+				cases()[case_count()++] = e;
+			}
+		}
+	};
+
+	//阻止编译器把结果当作无用计算删掉，x为标量校验值
+	template <typename T>
+	inline void keep(T x)
+	{
+		static volatile T sink;
+		sink = x;
+	}
+
+	//每次先运行setup（不计时）再计时work，取reps次中最快的一次，单位毫秒
+	template <typename Setup, typename Work>
+	double time_ms(Setup setup, Work work, int reps = 3)
+	{
+		double best = 0;
+		for (int i = 0; i != reps; ++i)
+		{
+			setup();
+			const auto start = std::chrono::steady_clock::now();
+			work();
+			const auto stop = std::chrono::steady_clock::now();
+			const double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+			if (i == 0 || ms < best)
+			{
+				best = ms;
+			}
+		}
+		return best;
+	}
+
+	template <typename Work>
+	double time_ms(Work work, int reps = 3)
+	{
+		return time_ms([] {}, work, reps);
+	}
+
+	inline void report(const char *label, size_t n, double ms)
+	{
+		std::printf("  %-36s n=%-11zu %12.3f ms %9.2f ns/elem\n", label, n, ms, n ? ms * 1e6 / n : 0.0);
+	}
+
+	inline void report_bytes(const char *label, size_t n, size_t bytes)
+	{
+		std::printf("  %-36s n=%-11zu %12.3f MB %9.2f B/elem\n", label, n, bytes / 1048576.0, n ? double(bytes) / n : 0.0);
+	}
+
+	//简单的xorshift，生成可复现的输入
+	struct random
+	{
+		unsigned long long state;
+
+		explicit random(unsigned long long seed = 0x9E3779B97F4A7C15ull) :state(seed) {}
+
+		unsigned long long operator()()
+		{
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+			return state;
+		}
+	};
+}
+
+#define BENCH_CASE(name) \
+	static void name(size_t max_n); \
+	static bench::registrar name##_registrar(#name, name); \
+	static void name(size_t max_n)
+//****************************************
+
+#endif // !__BENCH_H
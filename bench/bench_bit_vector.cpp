@@ -0,0 +1,64 @@
+#include "bench.h"
+#include "__Vector.h"
+#include "__Algorithm.h"
+
+using my_STL::vector;
+
+//按位压缩的vector<bool>与每个元素一字节的vector<unsigned char>对比：内存与按字处理的算法
+BENCH_CASE(bit_vector_vs_bytes)
+{
+	for (size_t n = 1000; n <= max_n; n *= 10)
+	{
+		vector<bool> bits(n, false), mask(n, true);
+		vector<unsigned char> bytes(n, 0), byte_mask(n, 1);
+		bench::random rng;
+		for (size_t i = 0; i != n / 64; ++i)
+		{
+			const size_t k = static_cast<size_t>(rng() % (n - 1));
+			bits[k] = true;
+			bytes[k] = 1;
+		}
+		bench::report_bytes("memory, vector<bool>", n, (bits.capacity() + 7) / 8);
+		bench::report_bytes("memory, bytes", n, bytes.capacity());
+
+		ptrdiff_t sum = 0;
+		bench::report("count, vector<bool>", n, bench::time_ms([&] { sum += my_STL::count(bits.begin(), bits.end(), true); }));
+		bench::report("count, bytes", n, bench::time_ms([&] {
+			sum += my_STL::count(bytes.begin(), bytes.end(), static_cast<unsigned char>(1));
+		}));
+
+		//只有最后一位为1时找第一个1
+		vector<bool> last_bit(n, false);
+		vector<unsigned char> last_byte(n, 0);
+		last_bit[n - 1] = true;
+		last_byte[n - 1] = 1;
+		bench::report("find, vector<bool>", n, bench::time_ms([&] {
+			sum += my_STL::find(last_bit.begin(), last_bit.end(), true) - last_bit.begin();
+		}));
+		bench::report("find, bytes", n, bench::time_ms([&] {
+			sum += my_STL::find(last_byte.begin(), last_byte.end(), static_cast<unsigned char>(1)) - last_byte.begin();
+		}));
+
+		bench::report("fill, vector<bool>", n, bench::time_ms([&] { my_STL::fill(last_bit.begin(), last_bit.end(), true); }));
+		bench::report("fill, bytes", n, bench::time_ms([&] {
+			my_STL::fill(last_byte.begin(), last_byte.end(), static_cast<unsigned char>(1));
+		}));
+
+		bench::report("flip, vector<bool>", n, bench::time_ms([&] { bits.flip(); }));
+		bench::report("flip, bytes", n, bench::time_ms([&] {
+			for (size_t i = 0; i != n; ++i)
+			{
+				bytes[i] ^= 1;
+			}
+		}));
+
+		bench::report("and, vector<bool>", n, bench::time_ms([&] { bits &= mask; }));
+		bench::report("and, bytes", n, bench::time_ms([&] {
+			for (size_t i = 0; i != n; ++i)
+			{
+				bytes[i] &= byte_mask[i];
+			}
+		}));
+		bench::keep(sum + bits[0] + bytes[0]);
+	}
+}
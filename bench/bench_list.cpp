@@ -0,0 +1,134 @@
+#include "bench.h"
+#include "__List.h"
+#include "__Vector.h"
+
+using my_STL::list;
+using my_STL::vector;
+
+namespace
+{
+	//节点按随机顺序串起来的链表，模拟长期增删之后节点在内存中散落的情形
+	template <typename List>
+	void build_scattered(List &l, size_t n)
+	{
+		List src;
+		vector<typename List::iterator> nodes;
+		nodes.reserve(n);
+		for (size_t i = 0; i != n; ++i)
+		{
+			src.push_back(static_cast<int>(i));
+			typename List::iterator last = src.end();
+			nodes.push_back(--last);
+		}
+		bench::random rng;
+		for (size_t i = n; i > 1; --i)
+		{
+			const size_t j = static_cast<size_t>(rng() % i);
+			typename List::iterator t = nodes[i - 1];
+			nodes[i - 1] = nodes[j];
+			nodes[j] = t;
+		}
+		for (size_t i = 0; i != n; ++i)
+		{
+			l.splice(l.end(), src, nodes[i]);
+		}
+	}
+
+	template <typename List>
+	long long walk(List &l)
+	{
+		long long sum = 0;
+		for (typename List::iterator it = l.begin(), last = l.end(); it != last; ++it)
+		{
+			sum += *it;
+		}
+		return sum;
+	}
+}
+
+//节点散落时：普通遍历、for_each_prefetched、relayout之后再普通遍历
+BENCH_CASE(list_traversal_relayout)
+{
+	for (size_t n = 1000; n <= max_n; n *= 10)
+	{
+		list<int> l;
+		build_scattered(l, n);
+		long long sum = 0;
+		bench::report("walk, scattered nodes", n, bench::time_ms([&] { sum += walk(l); }));
+		bench::report("for_each_prefetched, scattered", n, bench::time_ms([&] {
+			l.for_each_prefetched([&sum](int x) { sum += x; });
+		}));
+		bench::report("relayout", n, bench::time_ms([&] { l.relayout(); }, 1));
+		bench::report("walk, after relayout", n, bench::time_ms([&] { sum += walk(l); }));
+		bench::keep(sum);
+	}
+}
+
+//size()读缓存的元素个数，对照原先的做法distance(begin, end)；各调用100次
+BENCH_CASE(list_size_vs_distance)
+{
+	for (size_t n = 1000; n <= max_n; n *= 10)
+	{
+		list<int> l;
+		for (size_t i = 0; i != n; ++i)
+		{
+			l.push_back(static_cast<int>(i));
+		}
+		size_t total = 0;
+		bench::report("100 x size()", n, bench::time_ms([&] {
+			for (int k = 0; k != 100; ++k)
+			{
+				total += l.size();
+			}
+		}));
+		bench::report("100 x distance(begin, end)", n, bench::time_ms([&] {
+			for (int k = 0; k != 100; ++k)
+			{
+				total += static_cast<size_t>(my_STL::distance(l.begin(), l.end()));
+			}
+		}));
+		bench::keep(total);
+	}
+}
+
+//sort经由splice与merge维护元素个数，计时随机输入的排序
+BENCH_CASE(list_sort)
+{
+	for (size_t n = 1000; n <= max_n; n *= 10)
+	{
+		list<int> l;
+		bench::report("list::sort, random ints", n, bench::time_ms([&] {
+			l.clear();
+			bench::random rng;
+			for (size_t i = 0; i != n; ++i)
+			{
+				l.push_back(static_cast<int>(rng()));
+			}
+		}, [&] { l.sort(); }));
+		bench::keep(l.front());
+	}
+}
+
+//clear：默认配置器逐个归还节点，list_node_slab整块归还
+BENCH_CASE(list_clear_slab)
+{
+	for (size_t n = 1000; n <= max_n; n *= 10)
+	{
+		list<int> l;
+		bench::report("clear, list<int>", n, bench::time_ms([&] {
+			for (size_t i = 0; i != n; ++i)
+			{
+				l.push_back(static_cast<int>(i));
+			}
+		}, [&] { l.clear(); }));
+
+		list<int, my_STL::list_node_slab> s;
+		bench::report("clear, list<int, list_node_slab>", n, bench::time_ms([&] {
+			for (size_t i = 0; i != n; ++i)
+			{
+				s.push_back(static_cast<int>(i));
+			}
+		}, [&] { s.clear(); }));
+		bench::keep(l.size() + s.size());
+	}
+}
@@ -0,0 +1,19 @@
+#include <cstdlib>
+#include <cstring>
+#include "bench.h"
+
+int main(int argc, char **argv)
+{
+	const size_t max_n = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 10000000;
+	const char *prefix = argc > 2 ? argv[2] : "";
+	for (size_t i = 0; i != bench::case_count(); ++i)
+	{
+		const bench::case_entry &e = bench::cases()[i];
+		if (std::strncmp(e.name, prefix, std::strlen(prefix)) == 0)
+		{
+			std::printf("%s\n", e.name);
+			e.run(max_n);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <stdint.h>
+#include "bench.h"
+#include "__Vector.h"
+#include "__Radix_sort.h"
+#include "__Sort.h"
+
+namespace
+{
+	struct record
+	{
+		uint32_t key;
+		uint32_t payload;
+	};
+
+	struct record_key
+	{
+		uint32_t operator()(const record &r) const
+		{
+			return r.key;
+		}
+	};
+
+	struct record_less
+	{
+		bool operator()(const record &a, const record &b) const
+		{
+			return a.key < b.key;
+		}
+	};
+
+	//对同一份随机输入分别运行radix_sort、parallel_radix_sort和两种比较排序
+	template <typename T, typename Make, typename Key, typename Less>
+	void run_sorts(size_t max_n, Make make, Key key, Less less)
+	{
+		for (size_t n = 1000; n <= max_n; n *= 10)
+		{
+			my_STL::vector<T> input(n), work(n);
+			bench::random rng;
+			for (size_t i = 0; i != n; ++i)
+			{
+				input[i] = make(rng());
+			}
+			auto reset = [&] { std::copy(input.begin(), input.end(), work.begin()); };
+			bench::report("radix_sort", n, bench::time_ms(reset, [&] { my_STL::radix_sort(work.begin(), work.end(), key); }));
+			bench::report("parallel_radix_sort", n, bench::time_ms(reset, [&] { my_STL::parallel_radix_sort(work.begin(), work.end(), key); }));
+			bench::report("my_STL::stable_sort", n, bench::time_ms(reset, [&] { my_STL::stable_sort(work.begin(), work.end(), less); }));
+			bench::report("std::sort", n, bench::time_ms(reset, [&] { std::sort(work.begin(), work.end(), less); }));
+			bench::keep(key(work[n / 2]));
+		}
+	}
+
+	template <typename T>
+	struct identity
+	{
+		T operator()(const T &x) const
+		{
+			return x;
+		}
+	};
+
+	template <typename T>
+	struct less
+	{
+		bool operator()(const T &a, const T &b) const
+		{
+			return a < b;
+		}
+	};
+}
+
+BENCH_CASE(radix_sort_uint32)
+{
+	run_sorts<uint32_t>(max_n, [](unsigned long long r) { return static_cast<uint32_t>(r); }, identity<uint32_t>(), less<uint32_t>());
+}
+
+BENCH_CASE(radix_sort_uint64)
+{
+	run_sorts<uint64_t>(max_n, [](unsigned long long r) { return static_cast<uint64_t>(r); }, identity<uint64_t>(), less<uint64_t>());
+}
+
+BENCH_CASE(radix_sort_float)
+{
+	run_sorts<float>(max_n, [](unsigned long long r) { return static_cast<float>(static_cast<int32_t>(r)) * 1e-3f; }, identity<float>(), less<float>());
+}
+
+BENCH_CASE(radix_sort_record_key)
+{
+	run_sorts<record>(max_n, [](unsigned long long r) { record x = { static_cast<uint32_t>(r), static_cast<uint32_t>(r >> 32) }; return x; },
+		record_key(), record_less());
+}
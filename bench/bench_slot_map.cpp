@@ -0,0 +1,84 @@
+#include "bench.h"
+#include "__Slot_map.h"
+#include "__List.h"
+#include "__Vector.h"
+
+using my_STL::slot_map;
+using my_STL::list;
+using my_STL::vector;
+
+namespace
+{
+	struct entity
+	{
+		float x, y, z;
+		int id;
+	};
+
+	entity make_entity(size_t i)
+	{
+		entity e = { 1.0f, 2.0f, 3.0f, static_cast<int>(i) };
+		return e;
+	}
+}
+
+//n个实体，再做n次"随机删一个、插入一个"，最后整体遍历；list以保存的迭代器作为句柄
+BENCH_CASE(slot_map_churn_vs_list)
+{
+	for (size_t n = 1000; n <= max_n; n *= 10)
+	{
+		long long sum = 0;
+		slot_map<entity> sm;
+		vector<my_STL::slot_map_key> keys;
+		bench::report("slot_map, churn", n, bench::time_ms([&] {
+			sm.clear();
+			keys.clear();
+			for (size_t i = 0; i != n; ++i)
+			{
+				keys.push_back(sm.insert(make_entity(i)));
+			}
+			bench::random rng;
+			for (size_t i = 0; i != n; ++i)
+			{
+				const size_t k = static_cast<size_t>(rng() % n);
+				sm.erase(keys[k]);
+				keys[k] = sm.insert(make_entity(i));
+			}
+		}));
+		bench::report("slot_map, iterate", n, bench::time_ms([&] {
+			for (slot_map<entity>::iterator it = sm.begin(), last = sm.end(); it != last; ++it)
+			{
+				sum += it->id;
+			}
+		}));
+
+		list<entity> l;
+		vector<list<entity>::iterator> handles;
+		bench::report("list, churn", n, bench::time_ms([&] {
+			l.clear();
+			handles.clear();
+			for (size_t i = 0; i != n; ++i)
+			{
+				l.push_back(make_entity(i));
+				list<entity>::iterator last = l.end();
+				handles.push_back(--last);
+			}
+			bench::random rng;
+			for (size_t i = 0; i != n; ++i)
+			{
+				const size_t k = static_cast<size_t>(rng() % n);
+				l.erase(handles[k]);
+				l.push_back(make_entity(i));
+				list<entity>::iterator last = l.end();
+				handles[k] = --last;
+			}
+		}));
+		bench::report("list, iterate", n, bench::time_ms([&] {
+			for (list<entity>::iterator it = l.begin(), last = l.end(); it != last; ++it)
+			{
+				sum += it->id;
+			}
+		}));
+		bench::keep(sum);
+	}
+}
@@ -0,0 +1,84 @@
+#include "bench.h"
+#include "__Unrolled_list.h"
+#include "__List.h"
+
+using my_STL::unrolled_list;
+using my_STL::list;
+
+namespace
+{
+	template <typename List>
+	void fill(List &l, size_t n)
+	{
+		l.clear();
+		for (size_t i = 0; i != n; ++i)
+		{
+			l.push_back(static_cast<int>(i));
+		}
+	}
+
+	template <typename List>
+	long long walk(List &l)
+	{
+		long long sum = 0;
+		for (typename List::iterator it = l.begin(), last = l.end(); it != last; ++it)
+		{
+			sum += *it;
+		}
+		return sum;
+	}
+
+	//一趟遍历中在每个元素之前插入一个新元素，元素个数加倍
+	//unrolled_list的插入使同一节点的迭代器失效，须从返回值继续
+	template <typename List>
+	void insert_between(List &l)
+	{
+		for (typename List::iterator it = l.begin(); it != l.end(); ++it)
+		{
+			it = l.insert(it, -1);
+			++it;
+		}
+	}
+
+	//一趟遍历中隔一个删一个
+	template <typename List>
+	void erase_alternate(List &l)
+	{
+		for (typename List::iterator it = l.begin(); it != l.end(); )
+		{
+			it = l.erase(it);
+			if (it != l.end())
+			{
+				++it;
+			}
+		}
+	}
+
+	template <typename List>
+	void run(const char *name, size_t n)
+	{
+		char label[64];
+		List l;
+		long long sum = 0;
+		fill(l, n);
+		std::snprintf(label, sizeof(label), "%s, walk", name);
+		bench::report(label, n, bench::time_ms([&] { sum += walk(l); }));
+		std::snprintf(label, sizeof(label), "%s, insert between", name);
+		bench::report(label, n, bench::time_ms([&] { fill(l, n); }, [&] { insert_between(l); }));
+		std::snprintf(label, sizeof(label), "%s, walk 2n after insert", name);
+		bench::report(label, n, bench::time_ms([&] { sum += walk(l); }));
+		std::snprintf(label, sizeof(label), "%s, erase alternate", name);
+		bench::report(label, n, bench::time_ms([&] { fill(l, n); }, [&] { erase_alternate(l); }));
+		bench::keep(sum + static_cast<long long>(l.size()));
+	}
+}
+
+//unrolled_list与list：顺序遍历、遍历中插入、遍历中删除
+BENCH_CASE(unrolled_list_vs_list)
+{
+	for (size_t n = 1000; n <= max_n; n *= 10)
+	{
+		run<unrolled_list<int>>("unrolled_list", n);
+		run<list<int>>("list", n);
+	}
+}
@@ -0,0 +1,47 @@
+#include "bench.h"
+#include "__Vector.h"
+
+using my_STL::vector;
+
+namespace
+{
+	//逐个push_back到n的耗时；峰值内存为扩容瞬间新旧两块空间之和的最大值
+	template <typename Growth>
+	void push_back_growth(const char *label, size_t max_n)
+	{
+		char peak_label[64];
+		std::snprintf(peak_label, sizeof(peak_label), "%s peak", label);
+		for (size_t n = 1000; n <= max_n; n *= 10)
+		{
+			size_t sum = 0;
+			bench::report(label, n, bench::time_ms([&] {
+				vector<int, my_STL::allocator<int>, Growth> v;
+				for (size_t i = 0; i != n; ++i)
+				{
+					v.push_back(static_cast<int>(i));
+				}
+				sum += v.size();
+			}));
+			vector<int, my_STL::allocator<int>, Growth> v;
+			size_t peak = 0;
+			for (size_t i = 0; i != n; ++i)
+			{
+				const size_t old_capacity = v.capacity();
+				v.push_back(static_cast<int>(i));
+				if (v.capacity() != old_capacity && (old_capacity + v.capacity()) * sizeof(int) > peak)
+				{
+					peak = (old_capacity + v.capacity()) * sizeof(int);
+				}
+			}
+			bench::report_bytes(peak_label, n, peak);
+			bench::keep(sum);
+		}
+	}
+}
+
+BENCH_CASE(vector_growth_policies)
+{
+	push_back_growth<my_STL::vector_growth_double>("push_back, double", max_n);
+	push_back_growth<my_STL::vector_growth_half>("push_back, 1.5x", max_n);
+	push_back_growth<my_STL::vector_growth_size_class>("push_back, size class", max_n);
+}
@@ -1,8 +1,9 @@
 #ifndef __ALGORITHM_H
 #define __ALGORITHM_H
 
-#include <string.h>        //memmove
+#include <string.h>        //memmove memset
 #include "__Iterator.h"
+#include "__Segmented_iterator.h"
 #include "__Type_traits.h"
 
 namespace my_STL
@@ -18,7 +19,7 @@ namespace my_STL
 	template <typename T, typename Compare>
 	inline const T &max(const T &a, const T &b, Compare comp)
 	{
-		return comp(a, b) ? b : a;              //compȽϱ׼
+		return comp(a, b) ? b : a;              //由comp决定比较标准
 	}
 	//****************************************
 
@@ -33,7 +34,7 @@ namespace my_STL
 	template <typename T, typename Compare>
 	inline const T &min(const T &a, const T &b, Compare comp)
 	{
-		return comp(b, a) ? b : a;              //compȽϱ׼
+		return comp(b, a) ? b : a;              //由comp决定比较标准
 	}
 	//****************************************
 
@@ -62,13 +63,58 @@ namespace my_STL
 	//fill
 	//****************************************
 	template <typename ForwardIterator, typename T>
-	void fill(ForwardIterator first, ForwardIterator last, const T &value)
+	inline void fill(ForwardIterator first, ForwardIterator last, const T &value);
+
+	//单字节特化版，直接memset
+	inline void fill(char *first, char *last, const char &value)
+	{
+		memset(first, static_cast<unsigned char>(value), last - first);
+	}
+
+	inline void fill(signed char *first, signed char *last, const signed char &value)
+	{
+		memset(first, static_cast<unsigned char>(value), last - first);
+	}
+
+	inline void fill(unsigned char *first, unsigned char *last, const unsigned char &value)
+	{
+		memset(first, value, last - first);
+	}
+
+	template <typename ForwardIterator, typename T>
+	void __fill(ForwardIterator first, ForwardIterator last, const T &value, __false_type)
 	{
 		for (; first != last; ++first)
 		{
 			*first = value;
 		}
 	}
+
+	//分段迭代器版：逐段对段内区间fill
+	template <typename SegmentedIterator, typename T>
+	void __fill(SegmentedIterator first, SegmentedIterator last, const T &value, __true_type)
+	{
+		using traits = __segmented_iterator_traits<SegmentedIterator>;
+		typename traits::segment_iterator sfirst = traits::segment(first);
+		typename traits::segment_iterator slast = traits::segment(last);
+		if (sfirst == slast)
+		{
+			fill(traits::local(first), traits::local(last), value);
+			return;
+		}
+		fill(traits::local(first), traits::end(sfirst), value);
+		for (++sfirst; sfirst != slast; ++sfirst)
+		{
+			fill(traits::begin(sfirst), traits::end(sfirst), value);
+		}
+		fill(traits::begin(slast), traits::local(last), value);
+	}
+
+	template <typename ForwardIterator, typename T>
+	inline void fill(ForwardIterator first, ForwardIterator last, const T &value)
+	{
+		__fill(first, last, value, __is_segmented_iterator(first));
+	}
 	//****************************************
 
 	//fill_n
@@ -76,6 +122,7 @@ namespace my_STL
 	template <typename OutputIterator, typename Size, typename T>
 	OutputIterator fill_n(OutputIterator first, Size n, const T &value)
 	{
+		__output_size_hint(first, n);
 		for (; n > 0; --n, ++first)
 		{
 			*first = value;
@@ -86,28 +133,53 @@ namespace my_STL
 
 	//copy
 	//****************************************
-	//copy
+	//copy泛化版
 	template <typename InputIterator, typename OutputIterator>
 	inline OutputIterator copy(InputIterator first, InputIterator last, OutputIterator result)
+	{
+		return __copy_aux(first, last, result, __is_segmented_iterator(first));
+	}
+
+	template <typename InputIterator, typename OutputIterator>
+	inline OutputIterator __copy_aux(InputIterator first, InputIterator last, OutputIterator result, __false_type)
 	{
 		return __copy_dispatch<InputIterator, OutputIterator>()(first, last, result);
 	}
 
-	//copy1
+	//输入为分段迭代器：逐段copy，段内为指针时可走memmove
+	template <typename SegmentedIterator, typename OutputIterator>
+	OutputIterator __copy_aux(SegmentedIterator first, SegmentedIterator last, OutputIterator result, __true_type)
+	{
+		using traits = __segmented_iterator_traits<SegmentedIterator>;
+		typename traits::segment_iterator sfirst = traits::segment(first);
+		typename traits::segment_iterator slast = traits::segment(last);
+		if (sfirst == slast)
+		{
+			return copy(traits::local(first), traits::local(last), result);
+		}
+		result = copy(traits::local(first), traits::end(sfirst), result);
+		for (++sfirst; sfirst != slast; ++sfirst)
+		{
+			result = copy(traits::begin(sfirst), traits::end(sfirst), result);
+		}
+		return copy(traits::begin(slast), traits::local(last), result);
+	}
+
+	//copy特殊版1
 	inline char *copy(const char *first, const char *last, char *result)
 	{
 		memmove(result, first, last - first);
 		return result + (last - first);
 	}
 
-	//copy2
+	//copy特殊版2
 	inline wchar_t *copy(const wchar_t *first, const wchar_t *last, wchar_t *result)
 	{
 		memmove(result, first, last - first);
 		return result + (last - first);
 	}
 
-	//__copy_dispatch
+	//__copy_dispatch泛化版
 	template <typename InputIteraot, typename OutputIterator>
 	struct __copy_dispatch
 	{
@@ -117,7 +189,7 @@ namespace my_STL
 		}
 	};
 
-	//ƫػ1, T* T*
+	//偏特化版1, T* T*
 	template <typename T>
 	struct __copy_dispatch<T*, T*>
 	{
@@ -128,7 +200,7 @@ namespace my_STL
 		}
 	};
 
-	//ƫػ2, const T* T*
+	//偏特化版2, const T* T*
 	template <typename T>
 	struct __copy_dispatch<const T*, T*>
 	{
@@ -139,23 +211,24 @@ namespace my_STL
 		}
 	};
 
-	//InputIterator__copy
+	//InputIterator版__copy
 	template <typename InputIterator, typename OutputIterator>
 	inline OutputIterator __copy(InputIterator first, InputIterator last,
 		OutputIterator result, input_iterator_tag)
 	{
-		for (; first != last; ++result, ++first)       //ѭ ٶ
+		for (; first != last; ++result, ++first)       //迭代器决定循环， 速度慢
 		{
 			*result = *first;
 		}
 		return result;
 	}
 
-	//RandomAccessIterator__copy
+	//RandomAccessIterator版__copy
 	template <typename RandomAccessIterator, typename OutputIterator>
 	inline OutputIterator __copy(RandomAccessIterator first, RandomAccessIterator last, 
 		OutputIterator result, random_access_iterator_tag)
 	{
+		__output_size_hint(result, last - first);
 		return __copy_d(first, last, result, distance_type(first));
 	}
 
@@ -163,14 +236,14 @@ namespace my_STL
 	inline OutputIterator __copy_d(RandomAccessIterator first, RandomAccessIterator last, 
 		OutputIterator result, Distance*)
 	{
-		for (Distance n = last - first; n > 0; --n, ++result, ++first)  //nѭٶȿ
+		for (Distance n = last - first; n > 0; --n, ++result, ++first)  //用n决定循环，速度快
 		{
 			*result = *first;
 		}
 		return result;
 	}
 
-	//trivial assignment operator __copy_t
+	//trivial assignment operator版 __copy_t
 	template <typename T>
 	inline T *__copy_t(const T *first, const T *last, T *result, __true_type)
 	{
@@ -178,7 +251,7 @@ namespace my_STL
 		return result + (last - first);
 	}
 
-	//non-trivial assignment operator __copy_t
+	//non-trivial assignment operator版 __copy_t
 	template <typename T>
 	inline T *__copy_t(const T *first, const T *last, T *result, __false_type)
 	{
@@ -186,9 +259,193 @@ namespace my_STL
 	}
 	//****************************************
 
+	//find
+	//****************************************
+	template <typename InputIterator, typename T>
+	InputIterator __find(InputIterator first, InputIterator last, const T &value, input_iterator_tag)
+	{
+		while (first != last && !(*first == value))
+		{
+			++first;
+		}
+		return first;
+	}
+
+	//RandomAccessIterator版：展开4次，减少边界比较
+	template <typename RandomAccessIterator, typename T>
+	RandomAccessIterator __find(RandomAccessIterator first, RandomAccessIterator last, const T &value,
+		random_access_iterator_tag)
+	{
+		typename iterator_traits<RandomAccessIterator>::difference_type trip_count = (last - first) >> 2;
+		for (; trip_count > 0; --trip_count)
+		{
+			if (*first == value) return first;
+			++first;
+			if (*first == value) return first;
+			++first;
+			if (*first == value) return first;
+			++first;
+			if (*first == value) return first;
+			++first;
+		}
+		switch (last - first)
+		{
+		case 3:
+			if (*first == value) return first;
+			++first;
+		case 2:
+			if (*first == value) return first;
+			++first;
+		case 1:
+			if (*first == value) return first;
+			++first;
+		default:
+			return last;
+		}
+	}
+
+	template <typename InputIterator, typename T>
+	inline InputIterator __find_aux(InputIterator first, InputIterator last, const T &value, __false_type)
+	{
+		return __find(first, last, value, iterator_category(first));
+	}
+
+	//分段迭代器版：逐段在段内查找
+	template <typename SegmentedIterator, typename T>
+	SegmentedIterator __find_aux(SegmentedIterator first, SegmentedIterator last, const T &value, __true_type)
+	{
+		using traits = __segmented_iterator_traits<SegmentedIterator>;
+		using local_iterator = typename traits::local_iterator;
+		typename traits::segment_iterator sfirst = traits::segment(first);
+		typename traits::segment_iterator slast = traits::segment(last);
+		if (sfirst == slast)
+		{
+			local_iterator p = __find_aux(traits::local(first), traits::local(last), value, __false_type());
+			return traits::compose(sfirst, p);
+		}
+		local_iterator e = traits::end(sfirst);
+		local_iterator p = __find_aux(traits::local(first), e, value, __false_type());
+		if (p != e)
+		{
+			return traits::compose(sfirst, p);
+		}
+		for (++sfirst; sfirst != slast; ++sfirst)
+		{
+			e = traits::end(sfirst);
+			p = __find_aux(traits::begin(sfirst), e, value, __false_type());
+			if (p != e)
+			{
+				return traits::compose(sfirst, p);
+			}
+		}
+		p = __find_aux(traits::begin(slast), traits::local(last), value, __false_type());
+		return traits::compose(slast, p);
+	}
+
+	template <typename InputIterator, typename T>
+	inline InputIterator find(InputIterator first, InputIterator last, const T &value)
+	{
+		return __find_aux(first, last, value, __is_segmented_iterator(first));
+	}
+	//****************************************
+
+	//count
+	//****************************************
+	template <typename InputIterator, typename T>
+	typename iterator_traits<InputIterator>::difference_type count(InputIterator first, InputIterator last,
+		const T &value)
+	{
+		typename iterator_traits<InputIterator>::difference_type n = 0;
+		for (; first != last; ++first)
+		{
+			if (*first == value)
+			{
+				++n;
+			}
+		}
+		return n;
+	}
+	//****************************************
+
+	//for_each
+	//****************************************
+	template <typename InputIterator, typename Function>
+	Function __for_each(InputIterator first, InputIterator last, Function f, __false_type)
+	{
+		for (; first != last; ++first)
+		{
+			f(*first);
+		}
+		return f;
+	}
+
+	//f以引用在各段之间传递：lambda等可能不能赋值
+	template <typename InputIterator, typename Function>
+	inline void __for_each_ref(InputIterator first, InputIterator last, Function &f)
+	{
+		for (; first != last; ++first)
+		{
+			f(*first);
+		}
+	}
+
+	//分段迭代器版：逐段在段内遍历
+	template <typename SegmentedIterator, typename Function>
+	Function __for_each(SegmentedIterator first, SegmentedIterator last, Function f, __true_type)
+	{
+		using traits = __segmented_iterator_traits<SegmentedIterator>;
+		typename traits::segment_iterator sfirst = traits::segment(first);
+		typename traits::segment_iterator slast = traits::segment(last);
+		if (sfirst == slast)
+		{
+			__for_each_ref(traits::local(first), traits::local(last), f);
+			return f;
+		}
+		__for_each_ref(traits::local(first), traits::end(sfirst), f);
+		for (++sfirst; sfirst != slast; ++sfirst)
+		{
+			__for_each_ref(traits::begin(sfirst), traits::end(sfirst), f);
+		}
+		__for_each_ref(traits::begin(slast), traits::local(last), f);
+		return f;
+	}
+
+	template <typename InputIterator, typename Function>
+	inline Function for_each(InputIterator first, InputIterator last, Function f)
+	{
+		return __for_each(first, last, f, __is_segmented_iterator(first));
+	}
+	//****************************************
+
+	//transform
+	//****************************************
+	template <typename InputIterator, typename OutputIterator, typename UnaryOperation>
+	OutputIterator transform(InputIterator first, InputIterator last, OutputIterator result, UnaryOperation op)
+	{
+		__output_size_hint(result, first, last, iterator_category(first));
+		for (; first != last; ++first, ++result)
+		{
+			*result = op(*first);
+		}
+		return result;
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename BinaryOperation>
+	OutputIterator transform(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+		OutputIterator result, BinaryOperation op)
+	{
+		__output_size_hint(result, first1, last1, iterator_category(first1));
+		for (; first1 != last1; ++first1, ++first2, ++result)
+		{
+			*result = op(*first1, *first2);
+		}
+		return result;
+	}
+	//****************************************
+
 	//copy_backward
 	//****************************************
-	//copy_backward
+	//copy_backward泛化版
 	template <typename BidirectionalIterator1, typename BidirectionalIterator2>
 	inline BidirectionalIterator2 copy_backward(BidirectionalIterator1 first, 
 		BidirectionalIterator1 last, BidirectionalIterator2 result)
@@ -196,7 +453,7 @@ namespace my_STL
 		return __copy_backward_dispatch<BidirectionalIterator1, BidirectionalIterator2>()(first, last, result);
 	}
 
-	//__copy_backward_dispatch
+	//__copy_backward_dispatch泛化版
 	template <typename BidirectionalIterator1, typename BidirectionalIterator2>
 	struct __copy_backward_dispatch
 	{
@@ -207,7 +464,7 @@ namespace my_STL
 		}
 	};
 
-	//BidirectionalIterator__copy_backward
+	//BidirectionalIterator版__copy_backward
 	template <typename BidirectionalIterator1, typename BidirectionalIterator2, typename Distance>
 	inline BidirectionalIterator2 __copy_backward(BidirectionalIterator1 first,
 		BidirectionalIterator1 last, BidirectionalIterator2 result, bidirectional_iterator_tag, Distance*)
@@ -219,7 +476,7 @@ namespace my_STL
 		return result;
 	}
 
-	//RandomAccessIterator__copy_backward
+	//RandomAccessIterator版__copy_backward
 	template <typename RandomAccessIterator, typename BidirectionalIterator, typename Distance>
 	inline BidirectionalIterator __copy_backward(RandomAccessIterator first, 
 		RandomAccessIterator last, BidirectionalIterator result, Distance*)
@@ -231,6 +488,192 @@ namespace my_STL
 		}
 		return result;
 	}
+
+	//偏特化版1, T* T*
+	template <typename T>
+	struct __copy_backward_dispatch<T*, T*>
+	{
+		T *operator()(T *first, T *last, T *result)
+		{
+			using t = typename __type_traits<T>::has_trivial_assignment_operator;
+			return __copy_backward_t(first, last, result, t());
+		}
+	};
+
+	//偏特化版2, const T* T*
+	template <typename T>
+	struct __copy_backward_dispatch<const T*, T*>
+	{
+		T *operator()(const T *first, const T *last, T *result)
+		{
+			using t = typename __type_traits<T>::has_trivial_assignment_operator;
+			return __copy_backward_t(first, last, result, t());
+		}
+	};
+
+	//trivial assignment operator版 __copy_backward_t：memmove可处理重叠
+	template <typename T>
+	inline T *__copy_backward_t(const T *first, const T *last, T *result, __true_type)
+	{
+		const ptrdiff_t n = last - first;
+		memmove(result - n, first, sizeof(T) * n);
+		return result - n;
+	}
+
+	//non-trivial assignment operator版 __copy_backward_t
+	template <typename T>
+	inline T *__copy_backward_t(const T *first, const T *last, T *result, __false_type)
+	{
+		while (first != last)
+		{
+			*(--result) = *(--last);
+		}
+		return result;
+	}
+	//****************************************
+
+	//less
+	//****************************************
+	//默认比较标准，供带Compare参数的算法使用
+	template <typename T>
+	struct __less
+	{
+		bool operator()(const T &a, const T &b) const
+		{
+			return a < b;
+		}
+	};
+	//****************************************
+
+	//reverse
+	//****************************************
+	template <typename BidirectionalIterator>
+	inline void reverse(BidirectionalIterator first, BidirectionalIterator last)
+	{
+		__reverse(first, last, iterator_category(first));
+	}
+
+	//BidirectionalIterator版
+	template <typename BidirectionalIterator>
+	void __reverse(BidirectionalIterator first, BidirectionalIterator last, bidirectional_iterator_tag)
+	{
+		while (true)
+		{
+			if (first == last || first == --last)
+			{
+				return;
+			}
+			iter_swap(first++, last);
+		}
+	}
+
+	//RandomAccessIterator版
+	template <typename RandomAccessIterator>
+	void __reverse(RandomAccessIterator first, RandomAccessIterator last, random_access_iterator_tag)
+	{
+		while (first < last)
+		{
+			iter_swap(first++, --last);
+		}
+	}
+	//****************************************
+
+	//rotate
+	//****************************************
+	//交换[first, middle)和[middle, last)，返回原*first的新位置
+	template <typename BidirectionalIterator>
+	BidirectionalIterator rotate(BidirectionalIterator first, BidirectionalIterator middle,
+		BidirectionalIterator last)
+	{
+		if (first == middle)
+		{
+			return last;
+		}
+		if (middle == last)
+		{
+			return first;
+		}
+		reverse(first, middle);
+		reverse(middle, last);
+		while (first != middle && middle != last)
+		{
+			iter_swap(first++, --last);
+		}
+		if (first == middle)
+		{
+			reverse(middle, last);
+			return last;
+		}
+		else
+		{
+			reverse(first, middle);
+			return first;
+		}
+	}
+	//****************************************
+
+	//lower_bound
+	//****************************************
+	template <typename ForwardIterator, typename T, typename Compare>
+	ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const T &value, Compare comp)
+	{
+		typename iterator_traits<ForwardIterator>::difference_type len = distance(first, last);
+		while (len > 0)
+		{
+			typename iterator_traits<ForwardIterator>::difference_type half = len >> 1;
+			ForwardIterator middle = first;
+			advance(middle, half);
+			if (comp(*middle, value))
+			{
+				first = middle;
+				++first;
+				len = len - half - 1;
+			}
+			else
+			{
+				len = half;
+			}
+		}
+		return first;
+	}
+
+	template <typename ForwardIterator, typename T>
+	inline ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const T &value)
+	{
+		return lower_bound(first, last, value, __less<T>());
+	}
+	//****************************************
+
+	//upper_bound
+	//****************************************
+	template <typename ForwardIterator, typename T, typename Compare>
+	ForwardIterator upper_bound(ForwardIterator first, ForwardIterator last, const T &value, Compare comp)
+	{
+		typename iterator_traits<ForwardIterator>::difference_type len = distance(first, last);
+		while (len > 0)
+		{
+			typename iterator_traits<ForwardIterator>::difference_type half = len >> 1;
+			ForwardIterator middle = first;
+			advance(middle, half);
+			if (comp(value, *middle))
+			{
+				len = half;
+			}
+			else
+			{
+				first = middle;
+				++first;
+				len = len - half - 1;
+			}
+		}
+		return first;
+	}
+
+	template <typename ForwardIterator, typename T>
+	inline ForwardIterator upper_bound(ForwardIterator first, ForwardIterator last, const T &value)
+	{
+		return upper_bound(first, last, value, __less<T>());
+	}
 	//****************************************
 }
 #endif // !__ALGORITHM_H
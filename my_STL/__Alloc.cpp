@@ -9,30 +9,42 @@ namespace my_STL
 
 	void *alloc::allocate(size_t n)
 	{
-		if (n > __MAX_BYTES)  //128
+		if (n > __MAX_BYTES)  //超过128
 		{
 			return malloc(n);
 		}
 		int index = FREELISTS_INDEX(n);
 		obj *result = free_list[index];
-		if (result)      //list пռ
+		if (result)      //list 有空间
 		{
 			free_list[index] = result->next;
 			return result;
 		}
-		else         //ûпռ䣬ڴȡ
+		else         //没有空间，从内存池取
 		{
 			return refill(ROUND_UP(n));
 		}
 	}
 
+	//直接从内存池配置至多nobjs个相邻的n字节区块，实际个数写回nobjs，每个区块可单独deallocate
+	//n不是8的倍数或超过128时无法相邻，退化为配置一个
+	void *alloc::allocate_batch(size_t n, int &nobjs)
+	{
+		if (n > __MAX_BYTES || n % __ALIGN != 0)
+		{
+			nobjs = 1;
+			return allocate(n);
+		}
+		return chunk_alloc(n, nobjs);
+	}
+
 	void alloc::deallocate(void *p, size_t n)
 	{
-		if (n > __MAX_BYTES)   //128
+		if (n > __MAX_BYTES)   //大于128，还给堆
 		{
 			free(p);
 		}
-		else                   //free_list
+		else                   //还给free_list
 		{
 			int index = FREELISTS_INDEX(n);
 			obj *node = static_cast<obj *>(p);
@@ -85,13 +97,13 @@ namespace my_STL
 		size_t total_bytes = size * nobjs;
 		size_t bytes_left = end_free - start_free;
 
-		if (bytes_left >= total_bytes)              //ڴʣ
+		if (bytes_left >= total_bytes)              //内存池剩余满足需求
 		{
 			result = start_free;
 			start_free += total_bytes;
 			return result;
 		}
-		else if (bytes_left >= size)             //ڴزȫ󣬵㹻һ
+		else if (bytes_left >= size)             //内存池不完全满足需求，但足够一个以上区块
 		{
 			nobjs = bytes_left / size;
 			total_bytes = size * nobjs;
@@ -99,19 +111,19 @@ namespace my_STL
 			start_free += total_bytes;
 			return result;
 		}
-		else                                   //ʣһ鶼޷ṩ
+		else                                   //剩余连一个块都无法提供
 		{
-			if (bytes_left > 0)                //ʣʵfree_list
+			if (bytes_left > 0)                //将剩余分配给适当的free_list
 			{
 				int index = FREELISTS_INDEX(bytes_left);
 				((obj *)start_free)->next = free_list[index];
 				free_list[index] = (obj *)start_free;
 			}
 
-			//ڴ
+			//补充内存池
 			size_t bytes_to_get = 2 * total_bytes + ROUND_UP(heap_size >> 4);
 			start_free = static_cast<char *>(malloc(bytes_to_get));
-			if (start_free == 0)                      //heapռ䲻㣬mallocʧ
+			if (start_free == 0)                      //heap空间不足，malloc失败
 			{
 				for (int i = size; i <= __MAX_BYTES; i += __ALIGN)
 				{
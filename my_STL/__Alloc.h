@@ -8,19 +8,19 @@ namespace my_STL
 	class alloc
 	{
 	private:
-		//ϵ߽
+		//区块上调边界
 		enum
 		{
 			__ALIGN = 8
 		};
 
-		//
+		//区块上限
 		enum
 		{
 			__MAX_BYTES = 128
 		};
 
-		//free_lists 
+		//free_lists 个数
 		enum
 		{
 			__NFREELISTS = __MAX_BYTES / __ALIGN
@@ -35,33 +35,40 @@ namespace my_STL
 
 		static obj *free_list[__NFREELISTS];
 	private:
-		static char *start_free;         //ڴʼλ
-		static char *end_free;           //ڴؽλ
+		static char *start_free;         //内存池起始位置
+		static char *end_free;           //内存池结束位置
 		static size_t heap_size;
 
 	private:
-		//bytesϵ8ı
+		//将bytes上调至8的倍数
 		static size_t ROUND_UP(size_t bytes)
 		{
 			return (((bytes)+__ALIGN - 1) & ~(__ALIGN - 1));
 		}
 
-		//Сʹõnfree_listn0
+		//根据区块大小决定使用第n号free_list，n从0起
 		static size_t FREELISTS_INDEX(size_t bytes)
 		{
 			return (((bytes)+__ALIGN - 1) / __ALIGN - 1);
 		}
 
-		//free_listûпʱΪfree_listռ䣬¿ռȡڴ
+		//当free_list没有可用区块时，为free_list重新填充空间，新空间取自内存池
 		static void *refill(size_t n);
 
-		//ڴȡռ
+		//从内存池取空间
 		static char *chunk_alloc(size_t size, int &nobjs);
 
 	public:
 		static void *allocate(size_t n);
+		static void *allocate_batch(size_t n, int &nobjs);
 		static void deallocate(void *p, size_t n);
 		static void *reallocate(void *p, size_t old_size, size_t new_size);
+
+		//配置n字节实际占用的字节数：小区块为其free_list的区块大小，大区块按malloc常见的16字节粒度估计
+		static size_t size_class(size_t n)
+		{
+			return n > __MAX_BYTES ? ((n + 15) & ~size_t(15)) : ROUND_UP(n);
+		}
 	};
 }
 
@@ -1,6 +1,7 @@
 #ifndef __ALLOCATOR_H
 #define __ALLOCATOR_H
 
+#include <new>                //operator new
 #include "__Alloc.h"
 
 namespace my_STL
@@ -20,6 +21,7 @@ namespace my_STL
 	public:
 		static T *allocate();
 		static T *allocate(size_t n);
+		static T *allocate_batch(size_t &n);
 		static void deallocate(T *p);
 		static void deallocate(T *p, size_t n);
 	};
@@ -36,6 +38,16 @@ namespace my_STL
 		return static_cast<T *>(alloc::allocate(sizeof(T) * n));
 	}
 
+	//配置至多n个相邻的T，实际个数写回n，每个可单独deallocate(p)
+	template <typename T>
+	T *allocator<T>::allocate_batch(size_t &n)
+	{
+		int nobjs = static_cast<int>(n);
+		T *result = static_cast<T *>(alloc::allocate_batch(sizeof(T), nobjs));
+		n = nobjs;
+		return result;
+	}
+
 	template <typename T>
 	void allocator<T>::deallocate(T *p)
 	{
@@ -47,6 +59,52 @@ namespace my_STL
 	{
 		alloc::deallocate(static_cast<void *>(p), sizeof(T) * n);
 	}
+
+	//new_allocator
+	//****************************************
+	//接口与allocator相同，但直接经由::operator new/delete，可以在任意线程配置与释放
+	//alloc的free list没有加锁，一个线程配置、另一个线程释放的对象须改用它
+	template <typename T>
+	class new_allocator
+	{
+	public:
+		using value_type = T;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using reference = T&;
+		using const_reference = const T&;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+
+	public:
+		static T *allocate()
+		{
+			return static_cast<T *>(::operator new(sizeof(T)));
+		}
+
+		static T *allocate(size_t n)
+		{
+			return static_cast<T *>(::operator new(sizeof(T) * n));
+		}
+
+		//每次只给一个
+		static T *allocate_batch(size_t &n)
+		{
+			n = 1;
+			return allocate();
+		}
+
+		static void deallocate(T *p)
+		{
+			::operator delete(p);
+		}
+
+		static void deallocate(T *p, size_t)
+		{
+			::operator delete(p);
+		}
+	};
+	//****************************************
 }
 #endif // !__ALLOCATOR_H
 
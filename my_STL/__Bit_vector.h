@@ -0,0 +1,1051 @@
+#ifndef __BIT_VECTOR_H
+#define __BIT_VECTOR_H
+
+#include <climits>          //CHAR_BIT
+#include <string.h>         //memset memcpy
+#include <initializer_list>
+#include "__Config.h"
+#include "__Allocator.h"
+#include "__Algorithm.h"
+#include "__Iterator.h"
+#include "__Type_traits.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#ifdef __STL_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+//由__Vector.h在vector主模板之后包含
+namespace my_STL
+{
+	using __bit_word = size_t;
+
+	enum
+	{
+		__WORD_BIT = int(CHAR_BIT * sizeof(__bit_word))
+	};
+
+	//字操作
+	//****************************************
+	inline int __popcount(__bit_word w)
+	{
+#if defined(_MSC_VER) && defined(__STL_USE_POPCNT) && defined(_M_X64)
+		return static_cast<int>(__popcnt64(w));
+#elif defined(_MSC_VER) && defined(__STL_USE_POPCNT)
+		return static_cast<int>(__popcnt(w));
+#elif defined(__GNUC__)
+		return __builtin_popcountll(w);
+#else
+		//SWAR：先两位一组计数，再逐级合并
+		unsigned long long x = w;
+		x = x - ((x >> 1) & 0x5555555555555555ULL);
+		x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+		x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+		return static_cast<int>((x * 0x0101010101010101ULL) >> 56);
+#endif
+	}
+
+	//最低位的1的位置，w不能为0
+	inline unsigned __count_trailing_zeros(__bit_word w)
+	{
+#if defined(_MSC_VER) && defined(_M_X64)
+		unsigned long i;
+		_BitScanForward64(&i, w);
+		return i;
+#elif defined(_MSC_VER)
+		unsigned long i;
+		_BitScanForward(&i, w);
+		return i;
+#elif defined(__GNUC__)
+		return static_cast<unsigned>(__builtin_ctzll(w));
+#else
+		unsigned i = 0;
+		for (; !(w & 1); w >>= 1)
+		{
+			++i;
+		}
+		return i;
+#endif
+	}
+
+	//offset及以上各位
+	inline __bit_word __bit_mask_from(unsigned offset)
+	{
+		return ~__bit_word(0) << offset;
+	}
+
+	//offset以下各位
+	inline __bit_word __bit_mask_below(unsigned offset)
+	{
+		return offset == 0 ? __bit_word(0) : ~__bit_word(0) >> (__WORD_BIT - offset);
+	}
+	//****************************************
+
+	//__bit_reference
+	//****************************************
+	struct __bit_reference
+	{
+		__bit_word *p;
+		__bit_word mask;
+
+		__bit_reference(__bit_word *x, __bit_word y) :p(x), mask(y) {}
+
+		operator bool() const
+		{
+			return (*p & mask) != 0;
+		}
+
+		__bit_reference &operator=(bool x)
+		{
+			if (x)
+			{
+				*p |= mask;
+			}
+			else
+			{
+				*p &= ~mask;
+			}
+			return *this;
+		}
+
+		__bit_reference &operator=(const __bit_reference &x)
+		{
+			return *this = bool(x);
+		}
+
+		bool operator==(const __bit_reference &x) const
+		{
+			return bool(*this) == bool(x);
+		}
+
+		bool operator<(const __bit_reference &x) const
+		{
+			return !bool(*this) && bool(x);
+		}
+
+		void flip()
+		{
+			*p ^= mask;
+		}
+	};
+
+	//代理对象是右值，通用的swap(T&, T&)接不住
+	inline void swap(__bit_reference x, __bit_reference y)
+	{
+		bool temp = x;
+		x = y;
+		y = temp;
+	}
+	//****************************************
+
+	//__bit_iterator
+	//****************************************
+	struct __bit_iterator_base
+	{
+		__bit_word *p;
+		unsigned offset;
+
+		__bit_iterator_base(__bit_word *x, unsigned y) :p(x), offset(y) {}
+
+		void bump_up()
+		{
+			if (offset++ == __WORD_BIT - 1)
+			{
+				offset = 0;
+				++p;
+			}
+		}
+
+		void bump_down()
+		{
+			if (offset-- == 0)
+			{
+				offset = __WORD_BIT - 1;
+				--p;
+			}
+		}
+
+		void incr(ptrdiff_t i)
+		{
+			ptrdiff_t n = i + offset;
+			p += n / __WORD_BIT;
+			n = n % __WORD_BIT;
+			if (n < 0)
+			{
+				offset = unsigned(n) + __WORD_BIT;
+				--p;
+			}
+			else
+			{
+				offset = unsigned(n);
+			}
+		}
+
+		bool operator==(const __bit_iterator_base &x) const
+		{
+			return p == x.p && offset == x.offset;
+		}
+
+		bool operator!=(const __bit_iterator_base &x) const
+		{
+			return p != x.p || offset != x.offset;
+		}
+
+		bool operator<(const __bit_iterator_base &x) const
+		{
+			return p < x.p || (p == x.p && offset < x.offset);
+		}
+
+		bool operator>(const __bit_iterator_base &x) const
+		{
+			return x < *this;
+		}
+
+		bool operator<=(const __bit_iterator_base &x) const
+		{
+			return !(x < *this);
+		}
+
+		bool operator>=(const __bit_iterator_base &x) const
+		{
+			return !(*this < x);
+		}
+	};
+
+	inline ptrdiff_t operator-(const __bit_iterator_base &x, const __bit_iterator_base &y)
+	{
+		return __WORD_BIT * (x.p - y.p) + ptrdiff_t(x.offset) - ptrdiff_t(y.offset);
+	}
+
+	struct __bit_iterator :public __bit_iterator_base
+	{
+		using iterator_category = random_access_iterator_tag;
+		using value_type = bool;
+		using difference_type = ptrdiff_t;
+		using pointer = __bit_reference*;
+		using reference = __bit_reference;
+
+		__bit_iterator() :__bit_iterator_base(nullptr, 0) {}
+		__bit_iterator(__bit_word *x, unsigned y) :__bit_iterator_base(x, y) {}
+
+		reference operator*() const
+		{
+			return reference(p, __bit_word(1) << offset);
+		}
+
+		reference operator[](difference_type i) const
+		{
+			return *(*this + i);
+		}
+
+		__bit_iterator &operator++()
+		{
+			bump_up();
+			return *this;
+		}
+
+		__bit_iterator operator++(int)
+		{
+			__bit_iterator temp = *this;
+			bump_up();
+			return temp;
+		}
+
+		__bit_iterator &operator--()
+		{
+			bump_down();
+			return *this;
+		}
+
+		__bit_iterator operator--(int)
+		{
+			__bit_iterator temp = *this;
+			bump_down();
+			return temp;
+		}
+
+		__bit_iterator &operator+=(difference_type i)
+		{
+			incr(i);
+			return *this;
+		}
+
+		__bit_iterator &operator-=(difference_type i)
+		{
+			incr(-i);
+			return *this;
+		}
+
+		__bit_iterator operator+(difference_type i) const
+		{
+			__bit_iterator temp = *this;
+			return temp += i;
+		}
+
+		__bit_iterator operator-(difference_type i) const
+		{
+			__bit_iterator temp = *this;
+			return temp -= i;
+		}
+	};
+
+	struct __bit_const_iterator :public __bit_iterator_base
+	{
+		using iterator_category = random_access_iterator_tag;
+		using value_type = bool;
+		using difference_type = ptrdiff_t;
+		using pointer = const bool*;
+		using reference = bool;
+
+		__bit_const_iterator() :__bit_iterator_base(nullptr, 0) {}
+		__bit_const_iterator(__bit_word *x, unsigned y) :__bit_iterator_base(x, y) {}
+		__bit_const_iterator(const __bit_iterator &x) :__bit_iterator_base(x.p, x.offset) {}
+
+		reference operator*() const
+		{
+			return (*p & (__bit_word(1) << offset)) != 0;
+		}
+
+		reference operator[](difference_type i) const
+		{
+			return *(*this + i);
+		}
+
+		__bit_const_iterator &operator++()
+		{
+			bump_up();
+			return *this;
+		}
+
+		__bit_const_iterator operator++(int)
+		{
+			__bit_const_iterator temp = *this;
+			bump_up();
+			return temp;
+		}
+
+		__bit_const_iterator &operator--()
+		{
+			bump_down();
+			return *this;
+		}
+
+		__bit_const_iterator operator--(int)
+		{
+			__bit_const_iterator temp = *this;
+			bump_down();
+			return temp;
+		}
+
+		__bit_const_iterator &operator+=(difference_type i)
+		{
+			incr(i);
+			return *this;
+		}
+
+		__bit_const_iterator &operator-=(difference_type i)
+		{
+			incr(-i);
+			return *this;
+		}
+
+		__bit_const_iterator operator+(difference_type i) const
+		{
+			__bit_const_iterator temp = *this;
+			return temp += i;
+		}
+
+		__bit_const_iterator operator-(difference_type i) const
+		{
+			__bit_const_iterator temp = *this;
+			return temp -= i;
+		}
+	};
+	//****************************************
+
+	//按字处理位区间的算法
+	//****************************************
+	//[first, last)中为1的位数：首尾两个字用掩码截取，中间整字popcnt
+	inline ptrdiff_t __bit_count(const __bit_iterator_base &first, const __bit_iterator_base &last)
+	{
+		if (first.p == last.p)
+		{
+			return first.offset == last.offset ? 0
+				: __popcount(*first.p & __bit_mask_from(first.offset) & __bit_mask_below(last.offset));
+		}
+		ptrdiff_t n = __popcount(*first.p & __bit_mask_from(first.offset));
+		const __bit_word *p = first.p + 1;
+		for (; last.p - p >= 4; p += 4)
+		{
+			n += __popcount(p[0]) + __popcount(p[1]) + __popcount(p[2]) + __popcount(p[3]);
+		}
+		for (; p != last.p; ++p)
+		{
+			n += __popcount(*p);
+		}
+		if (last.offset != 0)
+		{
+			n += __popcount(*last.p & __bit_mask_below(last.offset));
+		}
+		return n;
+	}
+
+	//第一个值为value的位：把字与全0或全1异或后，问题变为找第一个1
+	//空区间不读任何字：first.p可能为空，或是末尾之后的字
+	template <typename BitIterator>
+	BitIterator __bit_find(BitIterator first, BitIterator last, bool value)
+	{
+		if (first == last)
+		{
+			return last;
+		}
+		const __bit_word flip = value ? __bit_word(0) : ~__bit_word(0);
+		if (first.p == last.p)
+		{
+			__bit_word w = (*first.p ^ flip) & __bit_mask_from(first.offset) & __bit_mask_below(last.offset);
+			return first.offset != last.offset && w ? BitIterator(first.p, __count_trailing_zeros(w)) : last;
+		}
+		__bit_word w = (*first.p ^ flip) & __bit_mask_from(first.offset);
+		if (w)
+		{
+			return BitIterator(first.p, __count_trailing_zeros(w));
+		}
+		for (__bit_word *p = first.p + 1; p != last.p; ++p)
+		{
+			if (*p != flip)
+			{
+				return BitIterator(p, __count_trailing_zeros(*p ^ flip));
+			}
+		}
+		if (last.offset != 0)
+		{
+			w = (*last.p ^ flip) & __bit_mask_below(last.offset);
+			if (w)
+			{
+				return BitIterator(last.p, __count_trailing_zeros(w));
+			}
+		}
+		return last;
+	}
+
+	inline void __bit_fill_word(__bit_word *p, __bit_word mask, bool value)
+	{
+		if (value)
+		{
+			*p |= mask;
+		}
+		else
+		{
+			*p &= ~mask;
+		}
+	}
+
+	//首尾两个字用掩码，中间整字memset
+	inline void __bit_fill(const __bit_iterator_base &first, const __bit_iterator_base &last, bool value)
+	{
+		if (first.p == last.p)
+		{
+			if (first.offset != last.offset)
+			{
+				__bit_fill_word(first.p, __bit_mask_from(first.offset) & __bit_mask_below(last.offset), value);
+			}
+			return;
+		}
+		__bit_fill_word(first.p, __bit_mask_from(first.offset), value);
+		memset(first.p + 1, value ? 0xff : 0, (last.p - first.p - 1) * sizeof(__bit_word));
+		if (last.offset != 0)
+		{
+			__bit_fill_word(last.p, __bit_mask_below(last.offset), value);
+		}
+	}
+
+	//dst op= src，逐字进行；SSE2下每次处理128位
+	struct __bit_and
+	{
+		static __bit_word apply(__bit_word a, __bit_word b)
+		{
+			return a & b;
+		}
+#ifdef __STL_USE_SSE2
+		static __m128i apply(__m128i a, __m128i b)
+		{
+			return _mm_and_si128(a, b);
+		}
+#endif
+	};
+
+	struct __bit_or
+	{
+		static __bit_word apply(__bit_word a, __bit_word b)
+		{
+			return a | b;
+		}
+#ifdef __STL_USE_SSE2
+		static __m128i apply(__m128i a, __m128i b)
+		{
+			return _mm_or_si128(a, b);
+		}
+#endif
+	};
+
+	struct __bit_xor
+	{
+		static __bit_word apply(__bit_word a, __bit_word b)
+		{
+			return a ^ b;
+		}
+#ifdef __STL_USE_SSE2
+		static __m128i apply(__m128i a, __m128i b)
+		{
+			return _mm_xor_si128(a, b);
+		}
+#endif
+	};
+
+	template <typename Op>
+	void __bit_words_apply(__bit_word *dst, const __bit_word *src, size_t n)
+	{
+#ifdef __STL_USE_SSE2
+		const size_t step = sizeof(__m128i) / sizeof(__bit_word);
+		for (; n >= step; n -= step, dst += step, src += step)
+		{
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst), Op::apply(a, b));
+		}
+#endif
+		for (; n != 0; --n, ++dst, ++src)
+		{
+			*dst = Op::apply(*dst, *src);
+		}
+	}
+
+	inline void __bit_words_flip(__bit_word *dst, size_t n)
+	{
+#ifdef __STL_USE_SSE2
+		const size_t step = sizeof(__m128i) / sizeof(__bit_word);
+		const __m128i ones = _mm_set1_epi32(-1);
+		for (; n >= step; n -= step, dst += step)
+		{
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_xor_si128(a, ones));
+		}
+#endif
+		for (; n != 0; --n, ++dst)
+		{
+			*dst = ~*dst;
+		}
+	}
+
+	//以下重载使通用算法作用于位区间时按字进行；value须为bool才会选中
+	inline void fill(__bit_iterator first, __bit_iterator last, const bool &value)
+	{
+		__bit_fill(first, last, value);
+	}
+
+	inline __bit_iterator find(__bit_iterator first, __bit_iterator last, const bool &value)
+	{
+		return __bit_find(first, last, value);
+	}
+
+	inline __bit_const_iterator find(__bit_const_iterator first, __bit_const_iterator last, const bool &value)
+	{
+		return __bit_find(first, last, value);
+	}
+
+	inline ptrdiff_t count(__bit_iterator first, __bit_iterator last, const bool &value)
+	{
+		const ptrdiff_t n = __bit_count(first, last);
+		return value ? n : (last - first) - n;
+	}
+
+	inline ptrdiff_t count(__bit_const_iterator first, __bit_const_iterator last, const bool &value)
+	{
+		const ptrdiff_t n = __bit_count(first, last);
+		return value ? n : (last - first) - n;
+	}
+	//****************************************
+
+	//vector<bool>
+	//****************************************
+	//每个元素占一位，按__bit_word整字配置；operator[]返回代理__bit_reference
+	//Alloc只用于区分型别，存储总是经由allocator<__bit_word>；增长策略按字数计算
+	//finish之后、同一个字内的位内容未定义，按字处理的算法都用掩码截掉
+	template <typename Alloc, typename Growth>
+	class vector<bool, Alloc, Growth>
+	{
+	public:
+		using value_type = bool;
+		using pointer = __bit_reference*;
+		using const_pointer = const bool*;
+		using iterator = __bit_iterator;
+		using const_iterator = __bit_const_iterator;
+		using reference = __bit_reference;
+		using const_reference = bool;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+
+	protected:
+		using data_allocator = allocator<__bit_word>;
+
+		iterator start;
+		iterator finish;
+		__bit_word *cap;           //可用空间尾部（按字）
+
+		static size_type words(size_type n)
+		{
+			return (n + __WORD_BIT - 1) / __WORD_BIT;
+		}
+
+		//已用到的字数（含最后一个不完整的字）
+		size_type used_words() const
+		{
+			return finish.p - start.p + (finish.offset != 0 ? 1 : 0);
+		}
+
+		size_type capacity_words() const
+		{
+			return cap - start.p;
+		}
+
+		void deallocate()
+		{
+			if (start.p)
+			{
+				data_allocator::deallocate(start.p, capacity_words());
+			}
+		}
+
+		void initialize(size_type n)
+		{
+			if (n == 0)
+			{
+				start = finish = iterator();
+				cap = nullptr;
+				return;
+			}
+			__bit_word *q = data_allocator::allocate(words(n));
+			start = iterator(q, 0);
+			finish = start + difference_type(n);
+			cap = q + words(n);
+		}
+
+		//换到len个字的新空间：已用的字整体memcpy
+		void reallocate(size_type len)
+		{
+			__bit_word *q = data_allocator::allocate(len);
+			const difference_type n = finish - start;
+			if (start.p)
+			{
+				memcpy(q, start.p, used_words() * sizeof(__bit_word));
+				deallocate();
+			}
+			start = iterator(q, 0);
+			finish = start + n;
+			cap = q + len;
+		}
+
+		//在position处腾出n位，返回腾出区间的起点（可能已位于新空间）
+		iterator make_room(iterator position, size_type n);
+
+		template <typename Integer>
+		void initialize_aux(Integer n, Integer value, __true_type)
+		{
+			initialize(static_cast<size_type>(n));
+			fill(start, finish, static_cast<bool>(value));
+		}
+
+		template <typename InputIterator>
+		void initialize_aux(InputIterator first, InputIterator last, __false_type)
+		{
+			initialize(0);
+			insert(end(), first, last);
+		}
+
+		template <typename Integer>
+		void insert_dispatch(iterator position, Integer n, Integer value, __true_type)
+		{
+			insert(position, static_cast<size_type>(n), static_cast<bool>(value));
+		}
+
+		template <typename InputIterator>
+		void insert_dispatch(iterator position, InputIterator first, InputIterator last, __false_type)
+		{
+			range_insert(position, first, last, iterator_category(first));
+		}
+
+		template <typename InputIterator>
+		void range_insert(iterator position, InputIterator first, InputIterator last, input_iterator_tag)
+		{
+			for (; first != last; ++first)
+			{
+				position = insert(position, *first);
+				++position;
+			}
+		}
+
+		template <typename ForwardIterator>
+		void range_insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+		{
+			const size_type n = distance(first, last);
+			if (n != 0)
+			{
+				copy(first, last, make_room(position, n));
+			}
+		}
+
+	public:
+		vector()
+		{
+			initialize(0);
+		}
+
+		vector(size_type n, bool value)
+		{
+			initialize(n);
+			fill(start, finish, value);
+		}
+
+		explicit vector(size_type n)
+		{
+			initialize(n);
+			fill(start, finish, false);
+		}
+
+		template <typename InputIterator>
+		vector(InputIterator first, InputIterator last)
+		{
+			using integral = typename __is_integer<InputIterator>::integral;
+			initialize_aux(first, last, integral());
+		}
+
+		vector(std::initializer_list<bool> il)
+		{
+			initialize(0);
+			insert(end(), il.begin(), il.end());
+		}
+
+		vector(const vector &v)
+		{
+			initialize(v.size());
+			if (start.p)
+			{
+				memcpy(start.p, v.start.p, v.used_words() * sizeof(__bit_word));
+			}
+		}
+
+		vector(vector &&v) :start(v.start), finish(v.finish), cap(v.cap)
+		{
+			v.start = v.finish = iterator();
+			v.cap = nullptr;
+		}
+
+		vector &operator=(const vector &v)
+		{
+			if (this != &v)
+			{
+				if (v.size() > capacity())
+				{
+					deallocate();
+					initialize(v.size());
+				}
+				finish = start + v.size();
+				if (start.p)
+				{
+					memcpy(start.p, v.start.p, v.used_words() * sizeof(__bit_word));
+				}
+			}
+			return *this;
+		}
+
+		vector &operator=(vector &&v)
+		{
+			if (this != &v)
+			{
+				deallocate();
+				start = v.start;
+				finish = v.finish;
+				cap = v.cap;
+				v.start = v.finish = iterator();
+				v.cap = nullptr;
+			}
+			return *this;
+		}
+
+		~vector()
+		{
+			deallocate();
+		}
+
+		iterator begin()
+		{
+			return start;
+		}
+
+		const_iterator begin() const
+		{
+			return start;
+		}
+
+		iterator end()
+		{
+			return finish;
+		}
+
+		const_iterator end() const
+		{
+			return finish;
+		}
+
+		size_type size() const
+		{
+			return size_type(finish - start);
+		}
+
+		size_type capacity() const
+		{
+			return capacity_words() * __WORD_BIT;
+		}
+
+		bool empty() const
+		{
+			return start == finish;
+		}
+
+		reference operator[](size_type n)
+		{
+			return start[difference_type(n)];
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return const_iterator(start)[difference_type(n)];
+		}
+
+		reference front()
+		{
+			return *start;
+		}
+
+		const_reference front() const
+		{
+			return *const_iterator(start);
+		}
+
+		reference back()
+		{
+			return *(finish - 1);
+		}
+
+		const_reference back() const
+		{
+			return *(const_iterator(finish) - 1);
+		}
+
+		bool operator==(const vector &rhs) const;
+
+		bool operator!=(const vector &rhs) const
+		{
+			return !(*this == rhs);
+		}
+
+		void reserve(size_type n)
+		{
+			if (n > capacity())
+			{
+				reallocate(words(n));
+			}
+		}
+
+		void shrink_to_fit()
+		{
+			if (start == finish)
+			{
+				deallocate();
+				initialize(0);
+			}
+			else if (used_words() != capacity_words())
+			{
+				reallocate(used_words());
+			}
+		}
+
+		void push_back(bool x)
+		{
+			if (finish.p != cap)
+			{
+				*finish = x;
+				++finish;
+			}
+			else
+			{
+				reallocate(Growth::next_capacity(capacity_words(), used_words() + 1, sizeof(__bit_word)));
+				*finish = x;
+				++finish;
+			}
+		}
+
+		void pop_back()
+		{
+			--finish;
+		}
+
+		iterator insert(iterator position, bool x)
+		{
+			if (position == finish)
+			{
+				const difference_type n = position - start;
+				push_back(x);
+				return start + n;
+			}
+			iterator i = make_room(position, 1);
+			*i = x;
+			return i;
+		}
+
+		void insert(iterator position, size_type n, bool x)
+		{
+			if (n != 0)
+			{
+				iterator i = make_room(position, n);
+				__bit_fill(i, i + difference_type(n), x);
+			}
+		}
+
+		template <typename InputIterator>
+		void insert(iterator position, InputIterator first, InputIterator last)
+		{
+			using integral = typename __is_integer<InputIterator>::integral;
+			insert_dispatch(position, first, last, integral());
+		}
+
+		//整体接到末尾，与vector<T>::append一致，copy到back_inserter时经由它
+		template <typename InputIterator>
+		void append(InputIterator first, InputIterator last)
+		{
+			range_insert(finish, first, last, iterator_category(first));
+		}
+
+		iterator erase(iterator position)
+		{
+			if (position + 1 != finish)
+			{
+				copy(position + 1, finish, position);
+			}
+			--finish;
+			return position;
+		}
+
+		iterator erase(iterator first, iterator last)
+		{
+			finish = copy(last, finish, first);
+			return first;
+		}
+
+		void resize(size_type new_size, bool x = false)
+		{
+			if (new_size < size())
+			{
+				finish = start + difference_type(new_size);
+			}
+			else
+			{
+				insert(finish, new_size - size(), x);
+			}
+		}
+
+		void clear()
+		{
+			finish = start;
+		}
+
+		void swap(vector &v)
+		{
+			my_STL::swap(start, v.start);
+			my_STL::swap(finish, v.finish);
+			my_STL::swap(cap, v.cap);
+		}
+
+		//按字取反
+		void flip()
+		{
+			__bit_words_flip(start.p, used_words());
+		}
+
+		//逐位与、或、异或，要求两者size()相同
+		vector &operator&=(const vector &v)
+		{
+			__bit_words_apply<__bit_and>(start.p, v.start.p, used_words());
+			return *this;
+		}
+
+		vector &operator|=(const vector &v)
+		{
+			__bit_words_apply<__bit_or>(start.p, v.start.p, used_words());
+			return *this;
+		}
+
+		vector &operator^=(const vector &v)
+		{
+			__bit_words_apply<__bit_xor>(start.p, v.start.p, used_words());
+			return *this;
+		}
+	};
+
+	/***********************************************************************/
+	//vector<bool>
+	/***********************************************************************/
+	template <typename Alloc, typename Growth>
+	typename vector<bool, Alloc, Growth>::iterator vector<bool, Alloc, Growth>::make_room(iterator position,
+		size_type n)
+	{
+		if (capacity() - size() >= n)
+		{
+			copy_backward(position, finish, finish + difference_type(n));
+			finish += difference_type(n);
+			return position;
+		}
+		//position之前的字整体memcpy，之后逐位搬到新位置
+		const size_type len = Growth::next_capacity(capacity_words(), words(size() + n), sizeof(__bit_word));
+		__bit_word *q = data_allocator::allocate(len);
+		const size_type prefix_words = position.p - start.p + (position.offset != 0 ? 1 : 0);
+		if (prefix_words != 0)
+		{
+			memcpy(q, start.p, prefix_words * sizeof(__bit_word));
+		}
+		iterator new_start(q, 0);
+		iterator new_position = new_start + (position - start);
+		iterator new_finish = copy(position, finish, new_position + difference_type(n));
+		deallocate();
+		start = new_start;
+		finish = new_finish;
+		cap = q + len;
+		return new_position;
+	}
+
+	//逐字比较，最后一个不完整的字用掩码截取
+	template <typename Alloc, typename Growth>
+	bool vector<bool, Alloc, Growth>::operator==(const vector &rhs) const
+	{
+		if (size() != rhs.size())
+		{
+			return false;
+		}
+		const size_type full = finish.p - start.p;
+		if (full != 0 && memcmp(start.p, rhs.start.p, full * sizeof(__bit_word)) != 0)
+		{
+			return false;
+		}
+		if (finish.offset == 0)
+		{
+			return true;
+		}
+		const __bit_word mask = __bit_mask_below(finish.offset);
+		return (start.p[full] & mask) == (rhs.start.p[full] & mask);
+	}
+	//****************************************
+}
+
+#endif // !__BIT_VECTOR_H
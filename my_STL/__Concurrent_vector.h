@@ -0,0 +1,652 @@
+#ifndef __CONCURRENT_VECTOR_H
+#define __CONCURRENT_VECTOR_H
+
+#include <atomic>
+#include <climits>          //CHAR_BIT
+#include <new>              //placement new
+#include <type_traits>
+#include <utility>
+#include "__Allocator.h"
+#include "__Construct.h"
+#include "__Iterator.h"
+#include "__Segmented_iterator.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace my_STL
+{
+	//最高位的1的位置，x不能为0
+	inline unsigned __floor_log2(size_t x)
+	{
+#if defined(_MSC_VER) && defined(_M_X64)
+		unsigned long i;
+		_BitScanReverse64(&i, x);
+		return i;
+#elif defined(_MSC_VER)
+		unsigned long i;
+		_BitScanReverse(&i, x);
+		return i;
+#elif defined(__GNUC__)
+		return static_cast<unsigned>(CHAR_BIT * sizeof(unsigned long long) - 1 - __builtin_clzll(x));
+#else
+		unsigned i = 0;
+		for (; x >>= 1; )
+		{
+			++i;
+		}
+		return i;
+#endif
+	}
+
+	//第0段容量的log2：使第0段超过alloc的小区块上限(128字节)，各段都直接走malloc，配置本身线程安全
+	constexpr unsigned __concurrent_first_log(size_t elem_size, unsigned l = 2)
+	{
+		return (size_t(2) << l) * elem_size > 128 ? l : __concurrent_first_log(elem_size, l + 1);
+	}
+
+	template <typename T>
+	class concurrent_vector;
+
+	//__concurrent_vector_iterator
+	//****************************************
+	template <typename T, typename Ref, typename Ptr>
+	struct __concurrent_vector_iterator
+	{
+		using iterator_category = random_access_iterator_tag;
+		using value_type = T;
+		using difference_type = ptrdiff_t;
+		using pointer = Ptr;
+		using reference = Ref;
+		using iterator = __concurrent_vector_iterator<T, T&, T*>;
+		using vector_type = concurrent_vector<T>;
+
+		const vector_type *v;
+		size_t index;
+
+		__concurrent_vector_iterator() :v(nullptr), index(0) {}
+		__concurrent_vector_iterator(const vector_type *x, size_t i) :v(x), index(i) {}
+		__concurrent_vector_iterator(const iterator &it) :v(it.v), index(it.index) {}
+
+		reference operator*() const
+		{
+			return const_cast<reference>((*v)[index]);
+		}
+
+		pointer operator->() const
+		{
+			return &**this;
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return *(*this + n);
+		}
+
+		bool operator==(const __concurrent_vector_iterator &it) const
+		{
+			return index == it.index;
+		}
+
+		bool operator!=(const __concurrent_vector_iterator &it) const
+		{
+			return index != it.index;
+		}
+
+		bool operator<(const __concurrent_vector_iterator &it) const
+		{
+			return index < it.index;
+		}
+
+		bool operator>(const __concurrent_vector_iterator &it) const
+		{
+			return it.index < index;
+		}
+
+		bool operator<=(const __concurrent_vector_iterator &it) const
+		{
+			return !(it.index < index);
+		}
+
+		bool operator>=(const __concurrent_vector_iterator &it) const
+		{
+			return !(index < it.index);
+		}
+
+		__concurrent_vector_iterator &operator++()
+		{
+			++index;
+			return *this;
+		}
+
+		__concurrent_vector_iterator operator++(int)
+		{
+			__concurrent_vector_iterator temp = *this;
+			++index;
+			return temp;
+		}
+
+		__concurrent_vector_iterator &operator--()
+		{
+			--index;
+			return *this;
+		}
+
+		__concurrent_vector_iterator operator--(int)
+		{
+			__concurrent_vector_iterator temp = *this;
+			--index;
+			return temp;
+		}
+
+		__concurrent_vector_iterator &operator+=(difference_type n)
+		{
+			index += n;
+			return *this;
+		}
+
+		__concurrent_vector_iterator &operator-=(difference_type n)
+		{
+			index -= n;
+			return *this;
+		}
+
+		__concurrent_vector_iterator operator+(difference_type n) const
+		{
+			return __concurrent_vector_iterator(v, index + n);
+		}
+
+		__concurrent_vector_iterator operator-(difference_type n) const
+		{
+			return __concurrent_vector_iterator(v, index - n);
+		}
+
+		difference_type operator-(const __concurrent_vector_iterator &it) const
+		{
+			return difference_type(index) - difference_type(it.index);
+		}
+	};
+
+	//段迭代器：第k段
+	template <typename T>
+	struct __concurrent_vector_segment
+	{
+		const concurrent_vector<T> *v;
+		size_t k;
+
+		__concurrent_vector_segment(const concurrent_vector<T> *x, size_t i) :v(x), k(i) {}
+
+		__concurrent_vector_segment &operator++()
+		{
+			++k;
+			return *this;
+		}
+
+		bool operator==(const __concurrent_vector_segment &s) const
+		{
+			return k == s.k;
+		}
+
+		bool operator!=(const __concurrent_vector_segment &s) const
+		{
+			return k != s.k;
+		}
+	};
+	//****************************************
+
+	//concurrent_vector
+	//****************************************
+	//只增不删的分段vector：第0段2 * B个元素，第k段(k >= 1)B * 2^k个元素，B = 2^__FIRST_LOG
+	//下标i所在的段为log2((i >> __FIRST_LOG) | 1)，段在段表中的位置固定，段表本身从不搬移
+	//因此元素地址在其生命期内不变，push_back/grow_by可由多个线程同时调用且不加锁：
+	//  先以fetch_add占下一段下标，缺段时各线程竞相配置，CAS失败的一方归还自己配置的段
+	//  构造完成后置该下标的就绪标志，再把count沿连续的就绪标志CAS推进，然后返回，不等待其他线程
+	//  前面占下的元素尚未构造完时count停在那里，由构造它的线程随后接着推进
+	//size()、end()只计入已发布的元素，读者可以一边增长一边for (i < v.size()) v[i]
+	//下标不小于size()的元素（例如经由其他手段得知的push_back返回值），须与放入它的线程另有同步才能读取
+	//下标一经占下便无法退回，因此放入元素的构造不得抛出：push_back先在栈上构造再移动进去
+	//整体操作中只有reserve可与其他操作并发；clear、复制、交换、析构都不能与任何操作（包括读取）并发
+	template <typename T>
+	class concurrent_vector
+	{
+		static_assert(std::is_nothrow_move_constructible<T>::value, "concurrent_vector requires nothrow move constructible T");
+
+	public:
+		using value_type = T;
+		using pointer = value_type*;
+		using iterator = __concurrent_vector_iterator<T, T&, T*>;
+		using const_iterator = __concurrent_vector_iterator<T, const T&, const T*>;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+
+	protected:
+		using data_allocator = allocator<value_type>;
+
+		enum
+		{
+			__FIRST_LOG = __concurrent_first_log(sizeof(T)),
+			__SEGMENTS = CHAR_BIT * sizeof(size_t) - __FIRST_LOG
+		};
+
+		static_assert(alignof(std::atomic<unsigned char>) == 1, "ready flags are stored unaligned after the elements");
+
+		//每段在segment_size(k)个元素之后紧跟同样个数的就绪标志，下标不小于count的元素构造完成时置1
+		std::atomic<T *> table[__SEGMENTS];         //段表，未配置的段为nullptr
+		std::atomic<size_type> claimed;            //已占下的元素个数
+		std::atomic<size_type> count;              //已发布的元素个数，[0, count)都已构造完成
+
+		template <typename Iterator>
+		friend struct __segmented_iterator_traits;
+
+		static size_type segment_index_of(size_type i)
+		{
+			return __floor_log2((i >> __FIRST_LOG) | 1);
+		}
+
+		//第k段第一个元素的下标
+		static size_type segment_base(size_type k)
+		{
+			return (size_type(1) << k & ~size_type(1)) << __FIRST_LOG;
+		}
+
+		static size_type segment_size(size_type k)
+		{
+			return (k == 0 ? size_type(2) : size_type(1) << k) << __FIRST_LOG;
+		}
+
+		//第k段配置的T个数：元素加上就绪标志
+		static size_type segment_units(size_type k)
+		{
+			return segment_size(k) + (segment_size(k) + sizeof(T) - 1) / sizeof(T);
+		}
+
+		static std::atomic<unsigned char> *ready_flags(T *p, size_type k)
+		{
+			return reinterpret_cast<std::atomic<unsigned char> *>(p + segment_size(k));
+		}
+
+		//取第k段，尚未配置时配置之
+		T *segment(size_type k);
+
+		//确保[first, last)所在的各段都已配置
+		void ensure_segments(size_type first, size_type last)
+		{
+			for (size_type k = segment_index_of(first), e = segment_index_of(last - 1); k <= e; ++k)
+			{
+				segment(k);
+			}
+		}
+
+		T *slot(size_type i) const
+		{
+			const size_type k = segment_index_of(i);
+			return table[k].load(std::memory_order_acquire) + (i - segment_base(k));
+		}
+
+		//占下n个下标，返回第一个
+		size_type claim(size_type n)
+		{
+			const size_type first = claimed.fetch_add(n, std::memory_order_relaxed);
+			if (n != 0)
+			{
+				ensure_segments(first, first + n);
+			}
+			return first;
+		}
+
+		//下标i已构造完成而尚未发布；所在段尚未配置时一定不是
+		bool ready(size_type i) const
+		{
+			const size_type k = segment_index_of(i);
+			T *p = table[k].load(std::memory_order_acquire);
+			return p && ready_flags(p, k)[i - segment_base(k)].load() != 0;
+		}
+
+		//[first, first + n)已构造完成：置就绪标志，再把count推进过从count起连续就绪的下标
+		//标志与count都用seq_cst：两个线程各置一个标志再查对方的标志，至少一方能看到另一方的
+		//因此count停下的位置，其元素的线程置标志之后一定能接着推进
+		//推进count的线程acquire了途经的标志，读到count的读者因此能看到[0, count)中全部元素
+		void publish(size_type first, size_type n)
+		{
+			for (size_type i = first; i != first + n; ++i)
+			{
+				const size_type k = segment_index_of(i);
+				ready_flags(table[k].load(std::memory_order_relaxed), k)[i - segment_base(k)].store(1);
+			}
+			size_type c = count.load();
+			for (;;)
+			{
+				size_type e = c;
+				while (ready(e))
+				{
+					++e;
+				}
+				//c处尚未就绪，由它的线程负责推进；CAS失败时c更新为当前的count，从那里重新扫描
+				if (e == c || count.compare_exchange_weak(c, e))
+				{
+					return;
+				}
+			}
+		}
+
+		void destroy_elements();
+		void deallocate();
+
+	public:
+		concurrent_vector() :claimed(0), count(0)
+		{
+			for (size_type k = 0; k != __SEGMENTS; ++k)
+			{
+				table[k].store(nullptr, std::memory_order_relaxed);
+			}
+		}
+
+		explicit concurrent_vector(size_type n) :concurrent_vector()
+		{
+			grow_by(n);
+		}
+
+		concurrent_vector(const concurrent_vector &v);
+
+		concurrent_vector &operator=(const concurrent_vector &v)
+		{
+			if (this != &v)
+			{
+				concurrent_vector temp(v);
+				swap(temp);
+			}
+			return *this;
+		}
+
+		~concurrent_vector()
+		{
+			destroy_elements();
+			deallocate();
+		}
+
+		iterator begin()
+		{
+			return iterator(this, 0);
+		}
+
+		const_iterator begin() const
+		{
+			return const_iterator(this, 0);
+		}
+
+		iterator end()
+		{
+			return iterator(this, size());
+		}
+
+		const_iterator end() const
+		{
+			return const_iterator(this, size());
+		}
+
+		size_type size() const
+		{
+			return count.load(std::memory_order_acquire);
+		}
+
+		bool empty() const
+		{
+			return size() == 0;
+		}
+
+		//已配置的连续若干段的总容量
+		size_type capacity() const
+		{
+			size_type k = 0;
+			while (k != __SEGMENTS && table[k].load(std::memory_order_acquire))
+			{
+				++k;
+			}
+			return k == 0 ? 0 : segment_base(k - 1) + segment_size(k - 1);
+		}
+
+		reference operator[](size_type n)
+		{
+			return *slot(n);
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return *slot(n);
+		}
+
+		reference front()
+		{
+			return *slot(0);
+		}
+
+		reference back()
+		{
+			return *slot(size() - 1);
+		}
+
+		//返回新元素的下标
+		size_type push_back(const T &x)
+		{
+			T temp(x);
+			return push_back(std::move(temp));
+		}
+
+		size_type push_back(T &&x)
+		{
+			const size_type i = claim(1);
+			::new(static_cast<void *>(slot(i))) T(std::move(x));
+			publish(i, 1);
+			return i;
+		}
+
+		template <typename... Args>
+		size_type emplace_back(Args&&... args)
+		{
+			return push_back(T(std::forward<Args>(args)...));
+		}
+
+		//一次占下n个元素，返回第一个的下标；[first, first + n)可能跨段
+		size_type grow_by(size_type n, const T &x)
+		{
+			static_assert(std::is_nothrow_copy_constructible<T>::value, "grow_by(n, x) requires nothrow copy constructible T");
+			const size_type first = claim(n);
+			for (size_type i = first; i != first + n; ++i)
+			{
+				construct(slot(i), x);
+			}
+			publish(first, n);
+			return first;
+		}
+
+		size_type grow_by(size_type n)
+		{
+			static_assert(std::is_nothrow_default_constructible<T>::value, "grow_by(n) requires nothrow default constructible T");
+			const size_type first = claim(n);
+			for (size_type i = first; i != first + n; ++i)
+			{
+				::new(static_cast<void *>(slot(i))) T();
+			}
+			publish(first, n);
+			return first;
+		}
+
+		//预先配置前n个元素所在的段，可与push_back并发
+		void reserve(size_type n)
+		{
+			if (n != 0)
+			{
+				ensure_segments(0, n);
+			}
+		}
+
+		//销毁全部元素，保留已配置的段
+		//不能与任何操作并发：正在读的元素会被销毁，已占下下标的push_back也会与之后的push_back重复占下同一下标
+		void clear()
+		{
+			destroy_elements();
+			const size_type n = count.load(std::memory_order_relaxed);
+			for (size_type k = 0; k != __SEGMENTS && segment_base(k) < n; ++k)
+			{
+				std::atomic<unsigned char> *flags = ready_flags(table[k].load(std::memory_order_relaxed), k);
+				const size_type len = n - segment_base(k) < segment_size(k) ? n - segment_base(k) : segment_size(k);
+				for (size_type i = 0; i != len; ++i)
+				{
+					flags[i].store(0, std::memory_order_relaxed);
+				}
+			}
+			claimed.store(0, std::memory_order_relaxed);
+			count.store(0, std::memory_order_relaxed);
+		}
+
+		void swap(concurrent_vector &v)
+		{
+			for (size_type k = 0; k != __SEGMENTS; ++k)
+			{
+				T *p = table[k].load(std::memory_order_relaxed);
+				table[k].store(v.table[k].load(std::memory_order_relaxed), std::memory_order_relaxed);
+				v.table[k].store(p, std::memory_order_relaxed);
+			}
+			//不与其他操作并发，两边都有claimed == count
+			const size_type n = count.load(std::memory_order_relaxed);
+			count.store(v.count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			v.count.store(n, std::memory_order_relaxed);
+			claimed.store(count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			v.claimed.store(n, std::memory_order_relaxed);
+		}
+	};
+
+	/***********************************************************************/
+	//concurrent_vector
+	/***********************************************************************/
+	template <typename T>
+	T *concurrent_vector<T>::segment(size_type k)
+	{
+		T *p = table[k].load(std::memory_order_acquire);
+		if (p)
+		{
+			return p;
+		}
+		T *q = data_allocator::allocate(segment_units(k));
+		std::atomic<unsigned char> *flags = ready_flags(q, k);
+		for (size_type i = 0; i != segment_size(k); ++i)
+		{
+			::new(static_cast<void *>(flags + i)) std::atomic<unsigned char>(0);
+		}
+		if (table[k].compare_exchange_strong(p, q, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			return q;
+		}
+		//其他线程已配置好此段，p为其结果
+		data_allocator::deallocate(q, segment_units(k));
+		return p;
+	}
+
+	template <typename T>
+	concurrent_vector<T>::concurrent_vector(const concurrent_vector &v) :concurrent_vector()
+	{
+		const size_type n = v.size();
+		if (n == 0)
+		{
+			return;
+		}
+		ensure_segments(0, n);
+		size_type i = 0;
+		try
+		{
+			for (; i != n; ++i)
+			{
+				construct(slot(i), v[i]);
+			}
+		}
+		catch (...)
+		{
+			claimed.store(i, std::memory_order_relaxed);
+			count.store(i, std::memory_order_relaxed);
+			destroy_elements();
+			deallocate();
+			throw;
+		}
+		claimed.store(n, std::memory_order_relaxed);
+		count.store(n, std::memory_order_relaxed);
+	}
+
+	template <typename T>
+	void concurrent_vector<T>::destroy_elements()
+	{
+		const size_type n = count.load(std::memory_order_relaxed);
+		for (size_type k = 0; k != __SEGMENTS && segment_base(k) < n; ++k)
+		{
+			T *p = table[k].load(std::memory_order_relaxed);
+			const size_type len = n - segment_base(k) < segment_size(k) ? n - segment_base(k) : segment_size(k);
+			destroy(p, p + len);
+		}
+	}
+
+	template <typename T>
+	void concurrent_vector<T>::deallocate()
+	{
+		for (size_type k = 0; k != __SEGMENTS; ++k)
+		{
+			T *p = table[k].load(std::memory_order_relaxed);
+			if (p)
+			{
+				data_allocator::deallocate(p, segment_units(k));
+				table[k].store(nullptr, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	template <typename T>
+	inline void swap(concurrent_vector<T> &a, concurrent_vector<T> &b)
+	{
+		a.swap(b);
+	}
+	//****************************************
+
+	//以段为段：copy/find/for_each在段内按指针遍历
+	//段边界上的迭代器一律归入前一段的段尾，这样尾后迭代器所在的段总是已配置的
+	template <typename T, typename Ref, typename Ptr>
+	struct __segmented_iterator_traits<__concurrent_vector_iterator<T, Ref, Ptr>>
+	{
+		using iterator = __concurrent_vector_iterator<T, Ref, Ptr>;
+		using vector_type = concurrent_vector<T>;
+		using is_segmented_iterator = __true_type;
+		using segment_iterator = __concurrent_vector_segment<T>;
+		using local_iterator = Ptr;
+
+		static segment_iterator segment(const iterator &it)
+		{
+			return segment_iterator(it.v, it.index == 0 ? 0 : vector_type::segment_index_of(it.index - 1));
+		}
+
+		static local_iterator local(const iterator &it)
+		{
+			if (it.index == 0)
+			{
+				return it.v->table[0].load(std::memory_order_acquire);
+			}
+			return it.v->slot(it.index - 1) + 1;
+		}
+
+		static local_iterator begin(const segment_iterator &s)
+		{
+			return s.v->table[s.k].load(std::memory_order_acquire);
+		}
+
+		static local_iterator end(const segment_iterator &s)
+		{
+			return begin(s) + vector_type::segment_size(s.k);
+		}
+
+		static iterator compose(const segment_iterator &s, local_iterator p)
+		{
+			return iterator(s.v, vector_type::segment_base(s.k) + (p ? p - begin(s) : 0));
+		}
+	};
+}
+
+#endif // !__CONCURRENT_VECTOR_H
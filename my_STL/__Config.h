@@ -0,0 +1,25 @@
+#ifndef __CONFIG_H
+#define __CONFIG_H
+
+//SIMD 支持
+//x64 下 SSE2 总是可用；x86 需要 /arch:SSE2 (_M_IX86_FP >= 2)
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define __STL_USE_SSE2
+#endif
+
+//popcnt指令：GCC/Clang由-mpopcnt给出__POPCNT__；MSVC没有对应的宏，/arch:AVX及以上时可用
+#if defined(__POPCNT__) || defined(__AVX__)
+#define __STL_USE_POPCNT
+#endif
+
+//软件预取，提示硬件提前把p所在的cache line载入
+#if defined(__STL_USE_SSE2)
+#include <xmmintrin.h>
+#define __STL_PREFETCH(p) _mm_prefetch(reinterpret_cast<const char *>(p), _MM_HINT_T0)
+#elif defined(__GNUC__)
+#define __STL_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define __STL_PREFETCH(p) ((void)0)
+#endif
+
+#endif // !__CONFIG_H
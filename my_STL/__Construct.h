@@ -2,15 +2,16 @@
 #define __CONSTRUCT_H
 
 #include <new>            //placement new
+#include <utility>        //forward
 #include "__Type_traits.h"
 
 namespace my_STL
 {
-	//construct
+	//construct，右值实参时移动构造
 	template <typename T1, typename T2>
-	inline void construct(T1 *p, const T2 &value)
+	inline void construct(T1 *p, T2 &&value)
 	{
-		new(p) T1(value);
+		new(p) T1(std::forward<T2>(value));
 	}
 
 	//destroy
@@ -26,7 +27,7 @@ namespace my_STL
 		__destroy(first, last, value_type(first));
 	}
 
-	//жǷtrivial destructor
+	//判断是否有trivial destructor
 	template <typename ForwardIterator, typename T>
 	inline void __destroy(ForwardIterator first, ForwardIterator last, T*)
 	{
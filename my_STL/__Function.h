@@ -0,0 +1,37 @@
+#ifndef __FUNCTION_H
+#define __FUNCTION_H
+
+namespace my_STL
+{
+	//算术类仿函数
+	//****************************************
+	template <typename T>
+	struct plus
+	{
+		T operator()(const T &x, const T &y) const
+		{
+			return x + y;
+		}
+	};
+
+	template <typename T>
+	struct minus
+	{
+		T operator()(const T &x, const T &y) const
+		{
+			return x - y;
+		}
+	};
+
+	template <typename T>
+	struct multiplies
+	{
+		T operator()(const T &x, const T &y) const
+		{
+			return x * y;
+		}
+	};
+	//****************************************
+}
+
+#endif // !__FUNCTION_H
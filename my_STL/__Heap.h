@@ -0,0 +1,160 @@
+#ifndef __HEAP_H
+#define __HEAP_H
+
+#include "__Iterator.h"
+#include "__Algorithm.h"
+
+namespace my_STL
+{
+	//comp(a, b)取反方向，用于在max-heap算法上维护min-heap
+	template <typename Compare>
+	struct __reverse_compare
+	{
+		Compare comp;
+		__reverse_compare(Compare c) :comp(c) {}
+		template <typename T1, typename T2>
+		bool operator()(const T1 &a, const T2 &b)
+		{
+			return comp(b, a);
+		}
+	};
+
+	//push_heap
+	//****************************************
+	//从holeIndex向上寻找value的位置
+	template <typename RandomAccessIterator, typename Distance, typename T, typename Compare>
+	void __push_heap(RandomAccessIterator first, Distance holeIndex, Distance topIndex, T value, Compare comp)
+	{
+		Distance parent = (holeIndex - 1) / 2;
+		while (holeIndex > topIndex && comp(*(first + parent), value))
+		{
+			*(first + holeIndex) = *(first + parent);
+			holeIndex = parent;
+			parent = (holeIndex - 1) / 2;
+		}
+		*(first + holeIndex) = value;
+	}
+
+	//新元素已位于last - 1
+	template <typename RandomAccessIterator, typename Compare>
+	inline void push_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		using distance = typename iterator_traits<RandomAccessIterator>::difference_type;
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		my_STL::__push_heap(first, distance((last - first) - 1), distance(0), value(*(last - 1)), comp);
+	}
+
+	template <typename RandomAccessIterator>
+	inline void push_heap(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		my_STL::push_heap(first, last, __less<value>());
+	}
+	//****************************************
+
+	//pop_heap
+	//****************************************
+	//把holeIndex处的洞下沉到叶子，再把value上溯到合适位置
+	template <typename RandomAccessIterator, typename Distance, typename T, typename Compare>
+	void __adjust_heap(RandomAccessIterator first, Distance holeIndex, Distance len, T value, Compare comp)
+	{
+		Distance topIndex = holeIndex;
+		Distance secondChild = 2 * holeIndex + 2;
+		while (secondChild < len)
+		{
+			if (comp(*(first + secondChild), *(first + (secondChild - 1))))
+			{
+				--secondChild;
+			}
+			*(first + holeIndex) = *(first + secondChild);
+			holeIndex = secondChild;
+			secondChild = 2 * (secondChild + 1);
+		}
+		if (secondChild == len)                  //只有左子节点
+		{
+			*(first + holeIndex) = *(first + (secondChild - 1));
+			holeIndex = secondChild - 1;
+		}
+		my_STL::__push_heap(first, holeIndex, topIndex, value, comp);
+	}
+
+	//把堆顶移到result，原*result放入堆中
+	template <typename RandomAccessIterator, typename Compare>
+	inline void __pop_heap(RandomAccessIterator first, RandomAccessIterator last, RandomAccessIterator result,
+		Compare comp)
+	{
+		using distance = typename iterator_traits<RandomAccessIterator>::difference_type;
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		value v = *result;
+		*result = *first;
+		my_STL::__adjust_heap(first, distance(0), distance(last - first), v, comp);
+	}
+
+	template <typename RandomAccessIterator, typename Compare>
+	inline void pop_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		if (last - first > 1)
+		{
+			my_STL::__pop_heap(first, last - 1, last - 1, comp);
+		}
+	}
+
+	template <typename RandomAccessIterator>
+	inline void pop_heap(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		my_STL::pop_heap(first, last, __less<value>());
+	}
+	//****************************************
+
+	//make_heap
+	//****************************************
+	template <typename RandomAccessIterator, typename Compare>
+	void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		using distance = typename iterator_traits<RandomAccessIterator>::difference_type;
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		distance len = last - first;
+		if (len < 2)
+		{
+			return;
+		}
+		for (distance parent = (len - 2) / 2; ; --parent)
+		{
+			my_STL::__adjust_heap(first, parent, len, value(*(first + parent)), comp);
+			if (parent == 0)
+			{
+				return;
+			}
+		}
+	}
+
+	template <typename RandomAccessIterator>
+	inline void make_heap(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		my_STL::make_heap(first, last, __less<value>());
+	}
+	//****************************************
+
+	//sort_heap
+	//****************************************
+	template <typename RandomAccessIterator, typename Compare>
+	void sort_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		while (last - first > 1)
+		{
+			my_STL::pop_heap(first, last--, comp);
+		}
+	}
+
+	template <typename RandomAccessIterator>
+	inline void sort_heap(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		my_STL::sort_heap(first, last, __less<value>());
+	}
+	//****************************************
+}
+
+#endif // !__HEAP_H
@@ -5,14 +5,14 @@
 
 namespace my_STL
 {
-	//
+	//迭代器类型
 	struct input_iterator_tag {};
 	struct output_iterator_tag {};
 	struct forward_iterator_tag :public input_iterator_tag {};
 	struct bidirectional_iterator_tag :public forward_iterator_tag {};
 	struct random_access_iterator_tag :public bidirectional_iterator_tag {};
 
-	//iterator
+	//iterator基类
 	template <typename Category, typename T, typename Distance = ptrdiff_t,
 			  typename Pointer = T*, typename Reference = T&>
 		struct iterator
@@ -110,7 +110,7 @@ namespace my_STL
 		using reference = const T&;
 	};
 
-	//ȡ
+	//获取迭代器类型
 	template <typename Iterator>
 	inline typename iterator_traits<Iterator>::iterator_category iterator_category(const Iterator &)
 	{
@@ -118,21 +118,21 @@ namespace my_STL
 		return category();
 	}
 
-	//ȡdistance_type
+	//获取迭代器distance_type
 	template <typename Iterator>
 	inline typename iterator_traits<Iterator>::difference_type *distance_type(const Iterator &)
 	{
 		return static_cast<typename iterator_traits<Iterator>::difference_type*>(0);
 	}
 
-	//ȡvalue type
+	//获取迭代器value type
 	template <typename Iterator>
 	inline typename iterator_traits<Iterator>::value_type *value_type(const Iterator &)
 	{
 		return static_cast<typename iterator_traits<Iterator>::value_type*>(0);
 	};
 
-	//
+	//计算迭代器距离
 	template <typename InputIterator>
 	inline typename iterator_traits<InputIterator>::difference_type 
 	__distance(InputIterator first, InputIterator last, input_iterator_tag)
@@ -161,7 +161,7 @@ namespace my_STL
 		return __distance(first, last, category());
 	}
 
-	//ƶָ
+	//迭代器移动指定距离
 	template <typename InputIterator, typename Distance>
 	inline void __advance(InputIterator &i, Distance n, input_iterator_tag)
 	{
@@ -196,8 +196,181 @@ namespace my_STL
 	inline void advance(InputIterator &i, Distance n)
 	{
 		using category = iterator_traits<InputIterator>::iterator_category;
-		__advance(i, n, category(i));
+		__advance(i, n, category());
 	}
+
+	//输出迭代器的尺寸提示
+	//****************************************
+	//算法已知将写出n个元素时调用__output_size_hint(result, n)，目的端借此一次预留足够空间
+	//默认什么也不做
+	template <typename OutputIterator, typename Size>
+	inline void __output_size_hint(OutputIterator &, Size)
+	{
+	}
+
+	//由输入区间给出提示，只有random access能O(1)得到长度
+	template <typename OutputIterator, typename InputIterator>
+	inline void __output_size_hint(OutputIterator &, InputIterator, InputIterator, input_iterator_tag)
+	{
+	}
+
+	template <typename OutputIterator, typename RandomAccessIterator>
+	inline void __output_size_hint(OutputIterator &result, RandomAccessIterator first, RandomAccessIterator last,
+		random_access_iterator_tag)
+	{
+		__output_size_hint(result, last - first);
+	}
+
+	//容器至少再容纳n个元素，默认什么也不做，由有reserve的容器重载
+	template <typename Container, typename Size>
+	inline void __container_reserve(Container &, Size)
+	{
+	}
+	//****************************************
+
+	//插入迭代器
+	//****************************************
+	//back_insert_iterator：赋值即push_back
+	template <typename Container>
+	class back_insert_iterator
+	{
+	public:
+		using iterator_category = output_iterator_tag;
+		using value_type = void;
+		using difference_type = void;
+		using pointer = void;
+		using reference = void;
+		using container_type = Container;
+
+		Container *container;                  //目的容器
+
+		explicit back_insert_iterator(Container &c) :container(&c) {}
+
+		back_insert_iterator &operator=(const typename Container::value_type &value)
+		{
+			container->push_back(value);
+			return *this;
+		}
+
+		back_insert_iterator &operator*()
+		{
+			return *this;
+		}
+
+		back_insert_iterator &operator++()
+		{
+			return *this;
+		}
+
+		back_insert_iterator &operator++(int)
+		{
+			return *this;
+		}
+	};
+
+	//尺寸提示转给容器
+	template <typename Container, typename Size>
+	inline void __output_size_hint(back_insert_iterator<Container> &result, Size n)
+	{
+		__container_reserve(*result.container, n);
+	}
+
+	template <typename Container>
+	inline back_insert_iterator<Container> back_inserter(Container &c)
+	{
+		return back_insert_iterator<Container>(c);
+	}
+
+	//front_insert_iterator：赋值即push_front
+	template <typename Container>
+	class front_insert_iterator
+	{
+	public:
+		using iterator_category = output_iterator_tag;
+		using value_type = void;
+		using difference_type = void;
+		using pointer = void;
+		using reference = void;
+		using container_type = Container;
+
+		Container *container;
+
+		explicit front_insert_iterator(Container &c) :container(&c) {}
+
+		front_insert_iterator &operator=(const typename Container::value_type &value)
+		{
+			container->push_front(value);
+			return *this;
+		}
+
+		front_insert_iterator &operator*()
+		{
+			return *this;
+		}
+
+		front_insert_iterator &operator++()
+		{
+			return *this;
+		}
+
+		front_insert_iterator &operator++(int)
+		{
+			return *this;
+		}
+	};
+
+	template <typename Container>
+	inline front_insert_iterator<Container> front_inserter(Container &c)
+	{
+		return front_insert_iterator<Container>(c);
+	}
+
+	//insert_iterator：赋值即在iter处insert，随后iter指向新元素之后
+	template <typename Container>
+	class insert_iterator
+	{
+	public:
+		using iterator_category = output_iterator_tag;
+		using value_type = void;
+		using difference_type = void;
+		using pointer = void;
+		using reference = void;
+		using container_type = Container;
+
+		Container *container;
+		typename Container::iterator iter;
+
+		insert_iterator(Container &c, typename Container::iterator i) :container(&c), iter(i) {}
+
+		insert_iterator &operator=(const typename Container::value_type &value)
+		{
+			iter = container->insert(iter, value);
+			++iter;
+			return *this;
+		}
+
+		insert_iterator &operator*()
+		{
+			return *this;
+		}
+
+		insert_iterator &operator++()
+		{
+			return *this;
+		}
+
+		insert_iterator &operator++(int)
+		{
+			return *this;
+		}
+	};
+
+	template <typename Container, typename Iterator>
+	inline insert_iterator<Container> inserter(Container &c, Iterator i)
+	{
+		return insert_iterator<Container>(c, typename Container::iterator(i));
+	}
+	//****************************************
 }
 
 #endif // !__ITERATOR_H
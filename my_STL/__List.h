@@ -2,13 +2,24 @@
 #define __LIST_H
 
 #include<utility>
+#include <new>            //bad_alloc
+#include "__Config.h"
 #include "__Allocator.h"
 #include "__Construct.h"
+#include "__Type_traits.h"
 #include "__Iterator.h"
 #include "__Algorithm.h"
+#include "__Prefetch_iterator.h"
 
 namespace my_STL
 {
+	enum
+	{
+		__LIST_RELAYOUT_BATCH = 64,          //relayout每次向内存池要的相邻节点数
+		__LIST_SLAB_MIN = 32,                //slab模式第一块的节点数，之后每块加倍
+		__LIST_SLAB_MAX = 4096               //slab模式每块节点数的上限
+	};
+
 	template <typename T>
 	struct __list_node
 	{
@@ -44,15 +55,309 @@ namespace my_STL
 
 	};
 
+	//list_node_slab
+	//****************************************
+	//作为list的Alloc参数时，节点取自链表自己配置的大块（slab），由链表持有：
+	//  同一链表的节点集中在少数几块内，相邻插入的节点在内存中也相邻
+	//  元素的析构为trivial且块只属于本链表时，clear与析构整块归还，不再逐节点走链
+	//两个链表之间splice后，双方的块并为一个池共同持有，直到都不再引用时才归还；
+	//此后的clear只能逐个把节点还给池
+	struct list_node_slab {};
+
+	struct __list_slab_block
+	{
+		__list_slab_block *next;
+		size_t bytes;
+	};
+
+	template <typename T>
+	struct __list_slab_pool
+	{
+		size_t refs;                    //持有本池的链表数 + 转发到本池的池数
+		__list_slab_pool *forward;      //非空时本池已并入forward，只作转发
+		__list_slab_block *blocks;
+		__list_node<T> *free_head;      //归还的节点，经由next串起
+		__list_node<T> *free_tail;
+		__list_node<T> *cur;            //当前块中尚未切出的部分
+		__list_node<T> *cur_end;
+		size_t next_block;              //下一块的节点数
+	};
+
+	//普通配置器：节点逐个向Alloc配置，没有状态
+	template <typename T, typename Alloc>
+	class __list_node_source
+	{
+	protected:
+		using node_type = __list_node<T>;
+		using is_slab = __false_type;
+
+		node_type *get_header()
+		{
+			return Alloc::allocate();
+		}
+
+		void put_header(node_type *p)
+		{
+			Alloc::deallocate(p);
+		}
+
+		node_type *get_node()
+		{
+			return Alloc::allocate();
+		}
+
+		void put_node(node_type *p)
+		{
+			Alloc::deallocate(p);
+		}
+
+		node_type *allocate_batch(size_t &n)
+		{
+			return Alloc::allocate_batch(n);
+		}
+
+		bool exclusive()
+		{
+			return false;
+		}
+
+		void release_pool() {}
+		void adopt(__list_node_source &) {}
+		void swap_source(__list_node_source &) {}
+	};
+
+	//slab模式
+	template <typename T>
+	class __list_node_source<T, list_node_slab>
+	{
+	protected:
+		using node_type = __list_node<T>;
+		using pool_type = __list_slab_pool<T>;
+		using is_slab = __true_type;
+
+		enum
+		{
+			//块头之后按节点对齐
+			__HEADER = (sizeof(__list_slab_block) + alignof(node_type) - 1) / alignof(node_type) * alignof(node_type)
+		};
+
+		pool_type *pool;                //第一次要节点时才建立
+
+		__list_node_source() :pool(nullptr) {}
+
+		//复制出的链表另建自己的池
+		__list_node_source(const __list_node_source &) :pool(nullptr) {}
+
+		__list_node_source &operator=(const __list_node_source &)
+		{
+			return *this;
+		}
+
+		~__list_node_source()
+		{
+			release(pool);
+		}
+
+		//头节点在链表之间交换，不能放在某个池里
+		node_type *get_header()
+		{
+			return allocator<node_type>::allocate();
+		}
+
+		void put_header(node_type *p)
+		{
+			allocator<node_type>::deallocate(p);
+		}
+
+		node_type *get_node()
+		{
+			pool_type *r = root_or_create();
+			if (r->free_head)
+			{
+				node_type *p = r->free_head;
+				r->free_head = p->next;
+				return p;
+			}
+			if (r->cur == r->cur_end)
+			{
+				new_block(r);
+			}
+			return r->cur++;
+		}
+
+		void put_node(node_type *p)
+		{
+			pool_type *r = root();
+			p->next = r->free_head;
+			if (!r->free_head)
+			{
+				r->free_tail = p;
+			}
+			r->free_head = p;
+		}
+
+		//从当前块切出至多n个相邻节点
+		node_type *allocate_batch(size_t &n)
+		{
+			pool_type *r = root_or_create();
+			if (r->cur == r->cur_end)
+			{
+				new_block(r);
+			}
+			if (n > size_t(r->cur_end - r->cur))
+			{
+				n = r->cur_end - r->cur;
+			}
+			node_type *p = r->cur;
+			r->cur += n;
+			return p;
+		}
+
+		//池只属于本链表
+		bool exclusive()
+		{
+			pool_type *r = root();
+			return r && r->refs == 1;
+		}
+
+		//放弃本链表对池的引用；最后一个引用者归还全部块
+		void release_pool()
+		{
+			release(pool);
+			pool = nullptr;
+		}
+
+		//other的节点将移入本链表：两者改为持有同一个池
+		void adopt(__list_node_source &other);
+
+		void swap_source(__list_node_source &s)
+		{
+			my_STL::swap(pool, s.pool);
+		}
+
+	private:
+		//沿转发找到真正的池，并让本链表直接持有它
+		pool_type *root()
+		{
+			if (pool && pool->forward)
+			{
+				pool_type *r = pool->forward;
+				while (r->forward)
+				{
+					r = r->forward;
+				}
+				++r->refs;
+				release(pool);
+				pool = r;
+			}
+			return pool;
+		}
+
+		pool_type *root_or_create()
+		{
+			pool_type *r = root();
+			if (!r)
+			{
+				r = pool = allocator<pool_type>::allocate();
+				r->refs = 1;
+				r->forward = nullptr;
+				r->blocks = nullptr;
+				r->free_head = r->free_tail = nullptr;
+				r->cur = r->cur_end = nullptr;
+				r->next_block = __LIST_SLAB_MIN;
+			}
+			return r;
+		}
+
+		static void new_block(pool_type *r)
+		{
+			const size_t n = r->next_block;
+			const size_t bytes = __HEADER + n * sizeof(node_type);
+			__list_slab_block *b = static_cast<__list_slab_block *>(alloc::allocate(bytes));
+			b->next = r->blocks;
+			b->bytes = bytes;
+			r->blocks = b;
+			r->cur = reinterpret_cast<node_type *>(reinterpret_cast<char *>(b) + __HEADER);
+			r->cur_end = r->cur + n;
+			if (n < __LIST_SLAB_MAX)
+			{
+				r->next_block = n * 2;
+			}
+		}
+
+		static void release(pool_type *p)
+		{
+			while (p && --p->refs == 0)
+			{
+				pool_type *next = p->forward;
+				for (__list_slab_block *b = p->blocks; b; )
+				{
+					__list_slab_block *temp = b->next;
+					alloc::deallocate(b, b->bytes);
+					b = temp;
+				}
+				allocator<pool_type>::deallocate(p);
+				p = next;
+			}
+		}
+	};
+
+	//b并入a：块链与空闲节点都归a，b此后只转发到a；b当前块剩下的部分不再切分，随块一起归还
+	template <typename T>
+	void __list_node_source<T, list_node_slab>::adopt(__list_node_source &other)
+	{
+		pool_type *b = other.root();
+		if (!b)
+		{
+			return;
+		}
+		pool_type *a = root();
+		if (!a)
+		{
+			pool = b;
+			++b->refs;
+			return;
+		}
+		if (a == b)
+		{
+			return;
+		}
+		if (b->blocks)
+		{
+			__list_slab_block *tail = b->blocks;
+			while (tail->next)
+			{
+				tail = tail->next;
+			}
+			tail->next = a->blocks;
+			a->blocks = b->blocks;
+			b->blocks = nullptr;
+		}
+		if (b->free_head)
+		{
+			b->free_tail->next = a->free_head;
+			if (!a->free_head)
+			{
+				a->free_tail = b->free_tail;
+			}
+			a->free_head = b->free_head;
+			b->free_head = b->free_tail = nullptr;
+		}
+		b->forward = a;
+		++a->refs;
+		other.root();
+	}
+	//****************************************
+
 	template <typename T, typename Alloc = allocator<__list_node<T>>>
-	class list
+	class list :protected __list_node_source<T, Alloc>
 	{
 		template<typename T>
 		friend struct __list_iterator;
 	protected:
 		using list_node = __list_node<T>;
 		using list_node_ptr = __list_node<T>*;
-		using list_node_allocator = Alloc;
+		using source_type = __list_node_source<T, Alloc>;
 
 	public:
 		using value_type = T;
@@ -63,25 +368,75 @@ namespace my_STL
 
 	protected:
 		list_node *node;
+		size_type length;          //元素个数，由各修改操作维护，size()为O(1)
 		void empty_initialize();
 
 	protected:
-		//ýڵ
+		//配置节点
 		list_node* get_node()
 		{
-			return list_node_allocator::allocate();
+			return source_type::get_node();
 		}
 
-		//ͷŽڵ
+		//释放节点
 		void put_node(list_node *p)
 		{
-			list_node_allocator::deallocate(p);
+			source_type::put_node(p);
 		}
 
-		//ٽڵ
+		//slab模式下整块归还全部节点，做不到时返回false，由调用者逐个销毁
+		bool release_nodes(__false_type)
+		{
+			return false;
+		}
+
+		bool release_nodes(__true_type)
+		{
+			if (!source_type::exclusive())
+			{
+				return false;
+			}
+			using trivial = typename __type_traits<T>::has_trivial_destructor;
+			destroy_elements(trivial());
+			source_type::release_pool();
+			return true;
+		}
+
+		void destroy_elements(__true_type) {}
+
+		void destroy_elements(__false_type)
+		{
+			for (list_node *cur = node->next; cur != node; cur = cur->next)
+			{
+				destroy(&cur->data);
+			}
+		}
+
+		//产生、销毁节点
 		list_node* create_node(const T &value);
 		void destroy_node(list_node *p);
 
+		//区间insert：先在链表外建好整条节点链，再O(1)接到pos之前
+		template <typename Integer>
+		void insert_dispatch(iterator pos, Integer n, Integer value, __true_type)
+		{
+			insert(pos, static_cast<size_type>(n), static_cast<T>(value));
+		}
+
+		template <typename InputIterator>
+		void insert_dispatch(iterator pos, InputIterator first, InputIterator last, __false_type)
+		{
+			range_insert(pos, first, last, iterator_category(first));
+		}
+
+		template <typename InputIterator>
+		void range_insert(iterator pos, InputIterator first, InputIterator last, input_iterator_tag);
+		template <typename ForwardIterator>
+		void range_insert(iterator pos, ForwardIterator first, ForwardIterator last, forward_iterator_tag);
+
+		void link_chain(iterator pos, list_node *head, list_node *tail, size_type n);
+		void destroy_chain(list_node *head);
+
 	public:
 		list();
 		list(size_type n, const T &val);
@@ -121,7 +476,12 @@ namespace my_STL
 
 		size_type size() const
 		{
-			return my_STL::distance(begin(), end());
+			return length;
+		}
+
+		size_type max_size() const
+		{
+			return size_type(-1) / sizeof(list_node);
 		}
 
 		//Element access
@@ -159,6 +519,8 @@ namespace my_STL
 		void swap(list &l)
 		{
 			my_STL::swap(node, l.node);
+			my_STL::swap(length, l.length);
+			source_type::swap_source(l);
 		}
 
 		//Operations
@@ -168,6 +530,7 @@ namespace my_STL
 		void splice(iterator pos, list &other);
 		void splice(iterator pos, list &other, iterator i);
 		void splice(iterator pos, list &other, iterator first, iterator last);
+		void splice(iterator pos, list &other, iterator first, iterator last, size_type n);
 		void merge(list &other);
 		template <typename Compare>
 		void merge(list &other, Compare comp);
@@ -178,6 +541,11 @@ namespace my_STL
 		void unique();
 		void sort();
 
+		//Traversal
+		template <typename Function>
+		Function for_each_prefetched(Function f, size_type distance = __LIST_PREFETCH_DISTANCE);
+		void relayout();
+
 		template <typename T>
 		friend bool operator==(const list<T> &lhs, const list<T> &rhs);
 		template <typename T>
@@ -241,9 +609,10 @@ namespace my_STL
 	template<typename T, typename Alloc>
 	inline void list<T, Alloc>::empty_initialize()
 	{
-		node = get_node();
+		node = source_type::get_header();
 		node->next = node;
 		node->prev = node;
+		length = 0;
 	}
 
 	template<typename T, typename Alloc>
@@ -282,10 +651,14 @@ namespace my_STL
 	list<T, Alloc>::list(InputIterator first, InputIterator last)
 	{
 		empty_initialize();
-		while (first != last)
+		try
 		{
-			push_back(*first);
-			++first;
+			insert(end(), first, last);
+		}
+		catch (...)
+		{
+			source_type::put_header(node);
+			throw;
 		}
 	}
 
@@ -334,13 +707,17 @@ namespace my_STL
 	list<T, Alloc>::~list()
 	{
 		clear();
-		put_node(node);
+		source_type::put_header(node);
 	}
 
 	template<typename T, typename Alloc>
 	void list<T, Alloc>::clear()
 	{
 		list_node *cur = node->next;
+		if (cur != node && release_nodes(typename source_type::is_slab()))
+		{
+			cur = node;
+		}
 		while (cur != node)
 		{
 			list_node *tmp = cur;
@@ -349,6 +726,7 @@ namespace my_STL
 		}
 		node->next = node;
 		node->prev = node;
+		length = 0;
 	}
 
 	template<typename T, typename Alloc>
@@ -359,6 +737,7 @@ namespace my_STL
 		temp->prev = pos.node->prev;
 		pos.node->prev->next = temp;
 		pos.node->prev = temp;
+		++length;
 		return temp;
 	}
 
@@ -375,10 +754,125 @@ namespace my_STL
 	template<typename InputIterator>
 	void list<T, Alloc>::insert(iterator pos, InputIterator first, InputIterator last)
 	{
-		while (first != last)
+		using integral = typename __is_integer<InputIterator>::integral;
+		insert_dispatch(pos, first, last, integral());
+	}
+
+	//节点链以nullptr结尾，尚未接入链表
+	template<typename T, typename Alloc>
+	void list<T, Alloc>::destroy_chain(list_node *head)
+	{
+		while (head)
 		{
-			insert(pos, *first);
-			++first;
+			list_node *next = head->next;
+			destroy_node(head);
+			head = next;
+		}
+	}
+
+	template<typename T, typename Alloc>
+	void list<T, Alloc>::link_chain(iterator pos, list_node *head, list_node *tail, size_type n)
+	{
+		head->prev = pos.node->prev;
+		tail->next = pos.node;
+		pos.node->prev->next = head;
+		pos.node->prev = tail;
+		length += n;
+	}
+
+	//构造抛出异常时销毁已建好的节点，链表保持不变
+	template<typename T, typename Alloc>
+	template<typename InputIterator>
+	void list<T, Alloc>::range_insert(iterator pos, InputIterator first, InputIterator last, input_iterator_tag)
+	{
+		if (first == last)
+		{
+			return;
+		}
+		list_node *head = create_node(*first);
+		list_node *tail = head;
+		size_type n = 1;
+		head->next = nullptr;
+		try
+		{
+			for (++first; first != last; ++first, ++n)
+			{
+				list_node *p = create_node(*first);
+				p->next = nullptr;
+				p->prev = tail;
+				tail->next = p;
+				tail = p;
+			}
+		}
+		catch (...)
+		{
+			destroy_chain(head);
+			throw;
+		}
+		link_chain(pos, head, tail, n);
+	}
+
+	//长度可知：按批配置相邻节点，和relayout一样使新插入的部分近似顺序排布
+	template<typename T, typename Alloc>
+	template<typename ForwardIterator>
+	void list<T, Alloc>::range_insert(iterator pos, ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+	{
+		const size_type total = my_STL::distance(first, last);
+		size_type remaining = total;
+		list_node *head = nullptr;
+		list_node *tail = nullptr;
+		try
+		{
+			while (remaining != 0)
+			{
+				size_t n = remaining < size_type(__LIST_RELAYOUT_BATCH) ? remaining : size_type(__LIST_RELAYOUT_BATCH);
+				list_node *batch = source_type::allocate_batch(n);
+				if (!batch)
+				{
+					throw std::bad_alloc();
+				}
+				size_t used = 0;
+				try
+				{
+					for (; used < n && remaining != 0; ++used, --remaining, ++first)
+					{
+						list_node *p = batch + used;
+						construct(&p->data, *first);
+						p->next = nullptr;
+						p->prev = tail;
+						if (tail)
+						{
+							tail->next = p;
+						}
+						else
+						{
+							head = p;
+						}
+						tail = p;
+					}
+				}
+				catch (...)
+				{
+					for (; used < n; ++used)
+					{
+						put_node(batch + used);
+					}
+					throw;
+				}
+				for (; used < n; ++used)
+				{
+					put_node(batch + used);
+				}
+			}
+		}
+		catch (...)
+		{
+			destroy_chain(head);
+			throw;
+		}
+		if (head)
+		{
+			link_chain(pos, head, tail, total);
 		}
 	}
 
@@ -389,6 +883,7 @@ namespace my_STL
 		pos.node->prev->next = pos.node->next;
 		pos.node->next->prev = pos.node->prev;
 		destroy_node(pos.node);
+		--length;
 		return temp;
 	}
 
@@ -436,6 +931,9 @@ namespace my_STL
 		if (!other.empty())
 		{
 			transfer(pos, other.begin(), other.end());
+			length += other.length;
+			other.length = 0;
+			source_type::adopt(other);
 		}
 	}
 
@@ -446,20 +944,44 @@ namespace my_STL
 		++j;
 		if (pos == i || pos == j) return;
 		transfer(pos, i, j);
+		if (&other != this)
+		{
+			++length;
+			--other.length;
+			source_type::adopt(other);
+		}
+	}
+
+	//区间长度要数出来，O(n)；同一链表内搬移时不必数
+	template<typename T, typename Alloc>
+	void list<T, Alloc>::splice(iterator pos, list &other, iterator first, iterator last)
+	{
+		if (first != last)
+		{
+			splice(pos, other, first, last, &other == this ? 0 : my_STL::distance(first, last));
+		}
 	}
 
+	//调用者给出区间长度n == distance(first, last)，O(1)
 	template<typename T, typename Alloc>
-	void list<T, Alloc>::splice(iterator pos, list & other, iterator first, iterator last)
+	void list<T, Alloc>::splice(iterator pos, list &other, iterator first, iterator last, size_type n)
 	{
 		if (first != last)
 		{
 			transfer(pos, first, last);
+			if (&other != this)
+			{
+				length += n;
+				other.length -= n;
+				source_type::adopt(other);
+			}
 		}
 	}
 
 	template<typename T, typename Alloc>
 	void list<T, Alloc>::merge(list & other)
 	{
+		if (&other == this) return;
 		iterator first1 = begin();
 		iterator last1 = end();
 		iterator first2 = other.begin();
@@ -481,12 +1003,16 @@ namespace my_STL
 		{
 			transfer(last1, first2, last2);
 		}
+		length += other.length;
+		other.length = 0;
+		source_type::adopt(other);
 	}
 
 	template <typename T, typename Alloc>
 	template <typename Compare>
 	void list<T, Alloc>::merge(list &other, Compare comp)
 	{
+		if (&other == this) return;
 		iterator first1 = begin();
 		iterator last1 = end();
 		iterator first2 = other.begin();
@@ -508,6 +1034,9 @@ namespace my_STL
 		{
 			transfer(last1, first2, last2);
 		}
+		length += other.length;
+		other.length = 0;
+		source_type::adopt(other);
 	}
 
 	template <typename T, typename Alloc>
@@ -571,6 +1100,80 @@ namespace my_STL
 		}
 	}
 
+	//遍历时领先distance个节点预取，使链上的载入延迟与f(x)重叠
+	template <typename T, typename Alloc>
+	template <typename Function>
+	Function list<T, Alloc>::for_each_prefetched(Function f, size_type distance)
+	{
+		list_node *ahead = node->next;
+		for (; distance > 0 && ahead != node; --distance)
+		{
+			ahead = ahead->next;
+		}
+		for (list_node *cur = node->next; cur != node; cur = cur->next)
+		{
+			if (ahead != node)
+			{
+				__STL_PREFETCH(ahead->next);
+				ahead = ahead->next;
+			}
+			f(cur->data);
+		}
+		return f;
+	}
+
+	//按链表顺序把元素移动到新配置的相邻节点中，之后的遍历近似顺序访问内存
+	//所有迭代器失效；移动构造可能抛出异常时改为复制，异常时已搬迁的部分保持搬迁后的状态，链表仍完整
+	//配置失败时抛出bad_alloc，链表不变
+	template <typename T, typename Alloc>
+	void list<T, Alloc>::relayout()
+	{
+		list_node *prev = node;
+		list_node *cur = node->next;
+		while (cur != node)
+		{
+			size_t n = __LIST_RELAYOUT_BATCH;
+			list_node *batch = source_type::allocate_batch(n);
+			if (!batch)
+			{
+				prev->next = cur;
+				cur->prev = prev;
+				throw std::bad_alloc();
+			}
+			size_t used = 0;
+			try
+			{
+				for (; used < n && cur != node; ++used)
+				{
+					list_node *p = batch + used;
+					construct(&p->data, std::move_if_noexcept(cur->data));
+					list_node *next = cur->next;
+					destroy_node(cur);
+					prev->next = p;
+					p->prev = prev;
+					prev = p;
+					cur = next;
+				}
+			}
+			catch (...)
+			{
+				prev->next = cur;
+				cur->prev = prev;
+				for (; used < n; ++used)
+				{
+					put_node(batch + used);
+				}
+				throw;
+			}
+			for (; used < n; ++used)         //最后一批用不完的节点
+			{
+				put_node(batch + used);
+			}
+		}
+		prev->next = node;
+		node->prev = prev;
+	}
+
 	template<typename T, typename Alloc>
 	void list<T, Alloc>::sort()
 	{
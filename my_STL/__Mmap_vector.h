@@ -0,0 +1,534 @@
+#ifndef __MMAP_VECTOR_H
+#define __MMAP_VECTOR_H
+
+#include <new>                //bad_alloc
+#include <type_traits>
+#include "__Algorithm.h"
+#include "__Vector.h"         //增长策略
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace my_STL
+{
+	//mmap_vector
+	//****************************************
+	//以内存映射文件为存储的vector：文件内容即元素数组，没有文件头
+	//open只建立映射、不读数据，多个进程映射同一文件时经由page cache共享
+	//增长时扩充文件再重新映射（Linux上为mremap），多出的容量在close时截掉
+	//元素直接位于映射区，只接受trivially copyable的T；所有指针在增长后失效
+	template <typename T, typename Growth = vector_growth_double>
+	class mmap_vector
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "mmap_vector requires trivially copyable T");
+
+	public:
+		using value_type = T;
+		using pointer = value_type*;
+		using iterator = value_type*;
+		using const_iterator = const value_type*;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+
+		//访问模式提示，对应madvise
+		enum access_hint
+		{
+			access_normal,
+			access_sequential,
+			access_random,
+			access_willneed
+		};
+
+	protected:
+		iterator start;            //映射区头部，容量为0时为nullptr
+		size_type count;           //元素个数
+		size_type cap;             //映射区可容纳的元素个数，也即文件长度
+		bool writable;
+		access_hint hint;          //重新映射后要再次生效
+#ifdef _WIN32
+		HANDLE file;
+		HANDLE mapping;
+#else
+		int fd;
+#endif
+
+		void reset()
+		{
+			start = nullptr;
+			count = cap = 0;
+			writable = false;
+			hint = access_normal;
+#ifdef _WIN32
+			file = INVALID_HANDLE_VALUE;
+			mapping = NULL;
+#else
+			fd = -1;
+#endif
+		}
+
+		bool map(size_type n);
+		void unmap();
+		bool set_file_size(size_type n);
+		bool remap(size_type n);
+		void apply_hint();
+
+		//增长失败与配置内存失败同等看待
+		void grow(size_type required)
+		{
+			if (!remap(Growth::next_capacity(cap, required, sizeof(T))))
+			{
+				throw std::bad_alloc();
+			}
+		}
+
+	public:
+		mmap_vector()
+		{
+			reset();
+		}
+
+		explicit mmap_vector(const char *path, bool read_only = false)
+		{
+			reset();
+			open(path, read_only);
+		}
+
+		mmap_vector(mmap_vector &&v) noexcept
+		{
+			reset();
+			swap(v);
+		}
+
+		mmap_vector &operator=(mmap_vector &&v) noexcept
+		{
+			if (this != &v)
+			{
+				close();
+				swap(v);
+			}
+			return *this;
+		}
+
+		mmap_vector(const mmap_vector &) = delete;
+		mmap_vector &operator=(const mmap_vector &) = delete;
+
+		~mmap_vector()
+		{
+			close();
+		}
+
+		//打开或创建path（read_only时不创建），元素个数为文件长度 / sizeof(T)
+		bool open(const char *path, bool read_only = false);
+		void close();
+
+		bool is_open() const
+		{
+#ifdef _WIN32
+			return file != INVALID_HANDLE_VALUE;
+#else
+			return fd >= 0;
+#endif
+		}
+
+		//把修改写回文件：sync等待写完，flush只发起写回
+		bool sync();
+		bool flush();
+
+		void advise(access_hint h)
+		{
+			hint = h;
+			apply_hint();
+		}
+
+		iterator begin()
+		{
+			return start;
+		}
+
+		const_iterator begin() const
+		{
+			return start;
+		}
+
+		iterator end()
+		{
+			return start + count;
+		}
+
+		const_iterator end() const
+		{
+			return start + count;
+		}
+
+		pointer data()
+		{
+			return start;
+		}
+
+		const value_type *data() const
+		{
+			return start;
+		}
+
+		size_type size() const
+		{
+			return count;
+		}
+
+		size_type capacity() const
+		{
+			return cap;
+		}
+
+		bool empty() const
+		{
+			return count == 0;
+		}
+
+		reference operator[](size_type n)
+		{
+			return start[n];
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return start[n];
+		}
+
+		reference front()
+		{
+			return *start;
+		}
+
+		reference back()
+		{
+			return start[count - 1];
+		}
+
+		void push_back(const T &x)
+		{
+			if (count == cap)
+			{
+				T x_copy = x;              //x可能就在映射区中
+				grow(count + 1);
+				start[count++] = x_copy;
+			}
+			else
+			{
+				start[count++] = x;
+			}
+		}
+
+		void pop_back()
+		{
+			--count;
+		}
+
+		void resize(size_type new_size, const T &x)
+		{
+			if (new_size > count)
+			{
+				T x_copy = x;
+				if (new_size > cap)
+				{
+					grow(new_size);
+				}
+				fill(start + count, start + new_size, x_copy);
+			}
+			count = new_size;
+		}
+
+		void resize(size_type new_size)
+		{
+			resize(new_size, T());
+		}
+
+		void reserve(size_type n)
+		{
+			if (n > cap && !remap(n))
+			{
+				throw std::bad_alloc();
+			}
+		}
+
+		//把文件截到size()
+		void shrink_to_fit()
+		{
+			if (count != cap)
+			{
+				remap(count);
+			}
+		}
+
+		void clear()
+		{
+			count = 0;
+		}
+
+		void swap(mmap_vector &v) noexcept
+		{
+			my_STL::swap(start, v.start);
+			my_STL::swap(count, v.count);
+			my_STL::swap(cap, v.cap);
+			my_STL::swap(writable, v.writable);
+			my_STL::swap(hint, v.hint);
+#ifdef _WIN32
+			my_STL::swap(file, v.file);
+			my_STL::swap(mapping, v.mapping);
+#else
+			my_STL::swap(fd, v.fd);
+#endif
+		}
+	};
+
+	/***********************************************************************/
+	//mmap_vector
+	/***********************************************************************/
+	template <typename T, typename Growth>
+	bool mmap_vector<T, Growth>::open(const char *path, bool read_only)
+	{
+		close();
+		writable = !read_only;
+		size_type bytes;
+#ifdef _WIN32
+		file = CreateFileA(path, read_only ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE,
+			FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, read_only ? OPEN_EXISTING : OPEN_ALWAYS,
+			FILE_ATTRIBUTE_NORMAL, NULL);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+		LARGE_INTEGER file_size;
+		if (!GetFileSizeEx(file, &file_size))
+		{
+			close();
+			return false;
+		}
+		bytes = static_cast<size_type>(file_size.QuadPart);
+#else
+		fd = ::open(path, read_only ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+		if (fd < 0)
+		{
+			return false;
+		}
+		struct stat st;
+		if (fstat(fd, &st) != 0)
+		{
+			close();
+			return false;
+		}
+		bytes = static_cast<size_type>(st.st_size);
+#endif
+		//长度不是sizeof(T)整数倍时忽略末尾不足一个元素的部分
+		if (bytes >= sizeof(T) && !map(bytes / sizeof(T)))
+		{
+			close();
+			return false;
+		}
+		count = cap;
+		return true;
+	}
+
+	template <typename T, typename Growth>
+	void mmap_vector<T, Growth>::close()
+	{
+		if (!is_open())
+		{
+			return;
+		}
+		const bool trim = writable && count != cap;
+		unmap();
+		if (trim)
+		{
+			set_file_size(count);
+		}
+#ifdef _WIN32
+		CloseHandle(file);
+#else
+		::close(fd);
+#endif
+		reset();
+	}
+
+	//映射文件的前n个元素，要求文件已至少这么长
+	template <typename T, typename Growth>
+	bool mmap_vector<T, Growth>::map(size_type n)
+	{
+		const size_type bytes = n * sizeof(T);
+#ifdef _WIN32
+		mapping = CreateFileMappingA(file, NULL, writable ? PAGE_READWRITE : PAGE_READONLY,
+			static_cast<DWORD>(static_cast<unsigned long long>(bytes) >> 32), static_cast<DWORD>(bytes), NULL);
+		if (mapping == NULL)
+		{
+			return false;
+		}
+		void *p = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, bytes);
+		if (p == NULL)
+		{
+			CloseHandle(mapping);
+			mapping = NULL;
+			return false;
+		}
+#else
+		void *p = mmap(nullptr, bytes, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+		if (p == MAP_FAILED)
+		{
+			return false;
+		}
+#endif
+		start = static_cast<iterator>(p);
+		cap = n;
+		apply_hint();
+		return true;
+	}
+
+	template <typename T, typename Growth>
+	void mmap_vector<T, Growth>::unmap()
+	{
+		if (start)
+		{
+#ifdef _WIN32
+			UnmapViewOfFile(start);
+			CloseHandle(mapping);
+			mapping = NULL;
+#else
+			munmap(start, cap * sizeof(T));
+#endif
+		}
+		start = nullptr;
+		cap = 0;
+	}
+
+	template <typename T, typename Growth>
+	bool mmap_vector<T, Growth>::set_file_size(size_type n)
+	{
+#ifdef _WIN32
+		LARGE_INTEGER pos;
+		pos.QuadPart = static_cast<LONGLONG>(n * sizeof(T));
+		return SetFilePointerEx(file, pos, NULL, FILE_BEGIN) && SetEndOfFile(file);
+#else
+		return ftruncate(fd, static_cast<off_t>(n * sizeof(T))) == 0;
+#endif
+	}
+
+	//把文件与映射区调整为n个元素；失败时保持原来的映射
+	template <typename T, typename Growth>
+	bool mmap_vector<T, Growth>::remap(size_type n)
+	{
+		if (!writable)
+		{
+			return false;
+		}
+		const size_type old_cap = cap;
+#if defined(MREMAP_MAYMOVE)
+		if (start && n != 0)
+		{
+			if (n > cap && !set_file_size(n))
+			{
+				return false;
+			}
+			void *p = mremap(start, cap * sizeof(T), n * sizeof(T), MREMAP_MAYMOVE);
+			if (p == MAP_FAILED)
+			{
+				if (n > cap)
+				{
+					set_file_size(cap);
+				}
+				return false;
+			}
+			if (n < cap)
+			{
+				set_file_size(n);
+			}
+			start = static_cast<iterator>(p);
+			cap = n;
+			apply_hint();         //新映射的部分还没有提示
+			return true;
+		}
+#endif
+		//先解除映射，截短文件要求文件上没有映射
+		unmap();
+		if (set_file_size(n) && (n == 0 || map(n)))
+		{
+			return true;
+		}
+		if (old_cap != 0)
+		{
+			set_file_size(old_cap);
+			map(old_cap);
+		}
+		return false;
+	}
+
+	template <typename T, typename Growth>
+	void mmap_vector<T, Growth>::apply_hint()
+	{
+		if (!start)
+		{
+			return;
+		}
+#ifdef _WIN32
+		//Windows没有对应的访问模式提示，只有预读
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+		if (hint == access_willneed)
+		{
+			WIN32_MEMORY_RANGE_ENTRY range;
+			range.VirtualAddress = start;
+			range.NumberOfBytes = cap * sizeof(T);
+			PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+		}
+#endif
+#else
+		static const int advice[] = { MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED };
+		madvise(start, cap * sizeof(T), advice[hint]);
+#endif
+	}
+
+	template <typename T, typename Growth>
+	bool mmap_vector<T, Growth>::sync()
+	{
+		if (!start || !writable)
+		{
+			return true;
+		}
+#ifdef _WIN32
+		return FlushViewOfFile(start, 0) && FlushFileBuffers(file);
+#else
+		return msync(start, cap * sizeof(T), MS_SYNC) == 0;
+#endif
+	}
+
+	template <typename T, typename Growth>
+	bool mmap_vector<T, Growth>::flush()
+	{
+		if (!start || !writable)
+		{
+			return true;
+		}
+#ifdef _WIN32
+		return FlushViewOfFile(start, 0) != 0;
+#else
+		return msync(start, cap * sizeof(T), MS_ASYNC) == 0;
+#endif
+	}
+
+	template <typename T, typename Growth>
+	inline void swap(mmap_vector<T, Growth> &a, mmap_vector<T, Growth> &b) noexcept
+	{
+		a.swap(b);
+	}
+	//****************************************
+}
+
+#endif // !__MMAP_VECTOR_H
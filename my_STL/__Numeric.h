@@ -0,0 +1,617 @@
+#ifndef __NUMERIC_H
+#define __NUMERIC_H
+
+#include "__Config.h"
+#include "__Allocator.h"
+#include "__Construct.h"
+#include "__Function.h"
+#include "__Iterator.h"
+#include "__Parallel.h"
+
+#ifdef __STL_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace my_STL
+{
+	enum
+	{
+		__SCAN_PARALLEL_THRESHOLD = 1 << 16      //小于此长度时不开线程
+	};
+
+	//accumulate
+	//****************************************
+	//严格从左到右累加
+	template <typename InputIterator, typename T>
+	T accumulate(InputIterator first, InputIterator last, T init)
+	{
+		for (; first != last; ++first)
+		{
+			init = init + *first;
+		}
+		return init;
+	}
+
+	template <typename InputIterator, typename T, typename BinaryOperation>
+	T accumulate(InputIterator first, InputIterator last, T init, BinaryOperation op)
+	{
+		for (; first != last; ++first)
+		{
+			init = op(init, *first);
+		}
+		return init;
+	}
+	//****************************************
+
+	//reduce
+	//****************************************
+	//op须满足结合律与交换律，允许任意顺序求值
+	//RandomAccessIterator版用4个独立的累加器打断依赖链
+	template <typename RandomAccessIterator, typename T, typename BinaryOperation>
+	T __reduce_unrolled(RandomAccessIterator first, RandomAccessIterator last, T init, BinaryOperation op)
+	{
+		ptrdiff_t n = last - first;
+		if (n < 8)
+		{
+			return accumulate(first, last, init, op);
+		}
+		T acc0 = first[0];
+		T acc1 = first[1];
+		T acc2 = first[2];
+		T acc3 = first[3];
+		ptrdiff_t i = 4;
+		for (; i + 4 <= n; i += 4)
+		{
+			acc0 = op(acc0, first[i]);
+			acc1 = op(acc1, first[i + 1]);
+			acc2 = op(acc2, first[i + 2]);
+			acc3 = op(acc3, first[i + 3]);
+		}
+		for (; i < n; ++i)
+		{
+			acc0 = op(acc0, first[i]);
+		}
+		return op(init, op(op(acc0, acc1), op(acc2, acc3)));
+	}
+
+	//连续空间上的求和，float/double/int配合plus时使用SSE2
+	template <typename T, typename BinaryOperation>
+	struct __reduce_kernel
+	{
+		template <typename U>
+		static T apply(const U *first, const U *last, T init, BinaryOperation op)
+		{
+			return __reduce_unrolled(first, last, init, op);
+		}
+	};
+
+#ifdef __STL_USE_SSE2
+	template <>
+	struct __reduce_kernel<float, plus<float>>
+	{
+		template <typename U>
+		static float apply(const U *first, const U *last, float init, plus<float> op)
+		{
+			return __reduce_unrolled(first, last, init, op);
+		}
+
+		static float apply(const float *first, const float *last, float init, plus<float>)
+		{
+			__m128 acc0 = _mm_setzero_ps();
+			__m128 acc1 = _mm_setzero_ps();
+			__m128 acc2 = _mm_setzero_ps();
+			__m128 acc3 = _mm_setzero_ps();
+			for (; last - first >= 16; first += 16)
+			{
+				acc0 = _mm_add_ps(acc0, _mm_loadu_ps(first));
+				acc1 = _mm_add_ps(acc1, _mm_loadu_ps(first + 4));
+				acc2 = _mm_add_ps(acc2, _mm_loadu_ps(first + 8));
+				acc3 = _mm_add_ps(acc3, _mm_loadu_ps(first + 12));
+			}
+			float lane[4];
+			_mm_storeu_ps(lane, _mm_add_ps(_mm_add_ps(acc0, acc1), _mm_add_ps(acc2, acc3)));
+			float sum = (lane[0] + lane[1]) + (lane[2] + lane[3]);
+			for (; first != last; ++first)
+			{
+				sum += *first;
+			}
+			return init + sum;
+		}
+	};
+
+	template <>
+	struct __reduce_kernel<double, plus<double>>
+	{
+		template <typename U>
+		static double apply(const U *first, const U *last, double init, plus<double> op)
+		{
+			return __reduce_unrolled(first, last, init, op);
+		}
+
+		static double apply(const double *first, const double *last, double init, plus<double>)
+		{
+			__m128d acc0 = _mm_setzero_pd();
+			__m128d acc1 = _mm_setzero_pd();
+			__m128d acc2 = _mm_setzero_pd();
+			__m128d acc3 = _mm_setzero_pd();
+			for (; last - first >= 8; first += 8)
+			{
+				acc0 = _mm_add_pd(acc0, _mm_loadu_pd(first));
+				acc1 = _mm_add_pd(acc1, _mm_loadu_pd(first + 2));
+				acc2 = _mm_add_pd(acc2, _mm_loadu_pd(first + 4));
+				acc3 = _mm_add_pd(acc3, _mm_loadu_pd(first + 6));
+			}
+			double lane[2];
+			_mm_storeu_pd(lane, _mm_add_pd(_mm_add_pd(acc0, acc1), _mm_add_pd(acc2, acc3)));
+			double sum = lane[0] + lane[1];
+			for (; first != last; ++first)
+			{
+				sum += *first;
+			}
+			return init + sum;
+		}
+	};
+
+	template <>
+	struct __reduce_kernel<int, plus<int>>
+	{
+		template <typename U>
+		static int apply(const U *first, const U *last, int init, plus<int> op)
+		{
+			return __reduce_unrolled(first, last, init, op);
+		}
+
+		static int apply(const int *first, const int *last, int init, plus<int>)
+		{
+			__m128i acc0 = _mm_setzero_si128();
+			__m128i acc1 = _mm_setzero_si128();
+			for (; last - first >= 8; first += 8)
+			{
+				acc0 = _mm_add_epi32(acc0, _mm_loadu_si128(reinterpret_cast<const __m128i *>(first)));
+				acc1 = _mm_add_epi32(acc1, _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + 4)));
+			}
+			int lane[4];
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(lane), _mm_add_epi32(acc0, acc1));
+			unsigned int sum = static_cast<unsigned int>(lane[0]) + lane[1] + lane[2] + lane[3];
+			for (; first != last; ++first)
+			{
+				sum += static_cast<unsigned int>(*first);
+			}
+			return static_cast<int>(static_cast<unsigned int>(init) + sum);
+		}
+	};
+#endif
+
+	template <typename InputIterator, typename T, typename BinaryOperation>
+	inline T __reduce(InputIterator first, InputIterator last, T init, BinaryOperation op, input_iterator_tag)
+	{
+		return accumulate(first, last, init, op);
+	}
+
+	template <typename RandomAccessIterator, typename T, typename BinaryOperation>
+	inline T __reduce(RandomAccessIterator first, RandomAccessIterator last, T init, BinaryOperation op,
+		random_access_iterator_tag)
+	{
+		return __reduce_unrolled(first, last, init, op);
+	}
+
+	//指针版，交给__reduce_kernel
+	template <typename U, typename T, typename BinaryOperation>
+	inline T __reduce(U *first, U *last, T init, BinaryOperation op, random_access_iterator_tag)
+	{
+		return __reduce_kernel<T, BinaryOperation>::apply(static_cast<const U *>(first),
+			static_cast<const U *>(last), init, op);
+	}
+
+	template <typename InputIterator, typename T, typename BinaryOperation>
+	inline T reduce(InputIterator first, InputIterator last, T init, BinaryOperation op)
+	{
+		return __reduce(first, last, init, op, iterator_category(first));
+	}
+
+	template <typename InputIterator, typename T>
+	inline T reduce(InputIterator first, InputIterator last, T init)
+	{
+		return reduce(first, last, init, plus<T>());
+	}
+
+	template <typename InputIterator>
+	inline typename iterator_traits<InputIterator>::value_type reduce(InputIterator first, InputIterator last)
+	{
+		using value = typename iterator_traits<InputIterator>::value_type;
+		return reduce(first, last, value(), plus<value>());
+	}
+	//****************************************
+
+	//transform_reduce
+	//****************************************
+	//两个区间：init op1 op2(a[0], b[0]) op1 op2(a[1], b[1]) ...
+	template <typename InputIterator1, typename InputIterator2, typename T,
+		typename BinaryOperation1, typename BinaryOperation2>
+	T __transform_reduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init,
+		BinaryOperation1 op1, BinaryOperation2 op2, input_iterator_tag)
+	{
+		for (; first1 != last1; ++first1, ++first2)
+		{
+			init = op1(init, op2(*first1, *first2));
+		}
+		return init;
+	}
+
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename T,
+		typename BinaryOperation1, typename BinaryOperation2>
+	T __transform_reduce(RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2,
+		T init, BinaryOperation1 op1, BinaryOperation2 op2, random_access_iterator_tag)
+	{
+		ptrdiff_t n = last1 - first1;
+		if (n < 8)
+		{
+			return __transform_reduce(first1, last1, first2, init, op1, op2, input_iterator_tag());
+		}
+		T acc0 = op2(first1[0], first2[0]);
+		T acc1 = op2(first1[1], first2[1]);
+		T acc2 = op2(first1[2], first2[2]);
+		T acc3 = op2(first1[3], first2[3]);
+		ptrdiff_t i = 4;
+		for (; i + 4 <= n; i += 4)
+		{
+			acc0 = op1(acc0, op2(first1[i], first2[i]));
+			acc1 = op1(acc1, op2(first1[i + 1], first2[i + 1]));
+			acc2 = op1(acc2, op2(first1[i + 2], first2[i + 2]));
+			acc3 = op1(acc3, op2(first1[i + 3], first2[i + 3]));
+		}
+		for (; i < n; ++i)
+		{
+			acc0 = op1(acc0, op2(first1[i], first2[i]));
+		}
+		return op1(init, op1(op1(acc0, acc1), op1(acc2, acc3)));
+	}
+
+	//点积：float/double配合plus、multiplies时使用SSE2
+	template <typename T, typename BinaryOperation1, typename BinaryOperation2>
+	struct __dot_kernel
+	{
+		template <typename U1, typename U2>
+		static T apply(const U1 *first1, const U1 *last1, const U2 *first2, T init,
+			BinaryOperation1 op1, BinaryOperation2 op2)
+		{
+			return __transform_reduce(first1, last1, first2, init, op1, op2, random_access_iterator_tag());
+		}
+	};
+
+#ifdef __STL_USE_SSE2
+	template <>
+	struct __dot_kernel<float, plus<float>, multiplies<float>>
+	{
+		template <typename U1, typename U2>
+		static float apply(const U1 *first1, const U1 *last1, const U2 *first2, float init,
+			plus<float> op1, multiplies<float> op2)
+		{
+			return __transform_reduce(first1, last1, first2, init, op1, op2, random_access_iterator_tag());
+		}
+
+		static float apply(const float *first1, const float *last1, const float *first2, float init,
+			plus<float>, multiplies<float>)
+		{
+			__m128 acc0 = _mm_setzero_ps();
+			__m128 acc1 = _mm_setzero_ps();
+			__m128 acc2 = _mm_setzero_ps();
+			__m128 acc3 = _mm_setzero_ps();
+			for (; last1 - first1 >= 16; first1 += 16, first2 += 16)
+			{
+				acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(first1), _mm_loadu_ps(first2)));
+				acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(first1 + 4), _mm_loadu_ps(first2 + 4)));
+				acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(first1 + 8), _mm_loadu_ps(first2 + 8)));
+				acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(first1 + 12), _mm_loadu_ps(first2 + 12)));
+			}
+			float lane[4];
+			_mm_storeu_ps(lane, _mm_add_ps(_mm_add_ps(acc0, acc1), _mm_add_ps(acc2, acc3)));
+			float sum = (lane[0] + lane[1]) + (lane[2] + lane[3]);
+			for (; first1 != last1; ++first1, ++first2)
+			{
+				sum += *first1 * *first2;
+			}
+			return init + sum;
+		}
+	};
+
+	template <>
+	struct __dot_kernel<double, plus<double>, multiplies<double>>
+	{
+		template <typename U1, typename U2>
+		static double apply(const U1 *first1, const U1 *last1, const U2 *first2, double init,
+			plus<double> op1, multiplies<double> op2)
+		{
+			return __transform_reduce(first1, last1, first2, init, op1, op2, random_access_iterator_tag());
+		}
+
+		static double apply(const double *first1, const double *last1, const double *first2, double init,
+			plus<double>, multiplies<double>)
+		{
+			__m128d acc0 = _mm_setzero_pd();
+			__m128d acc1 = _mm_setzero_pd();
+			__m128d acc2 = _mm_setzero_pd();
+			__m128d acc3 = _mm_setzero_pd();
+			for (; last1 - first1 >= 8; first1 += 8, first2 += 8)
+			{
+				acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(first1), _mm_loadu_pd(first2)));
+				acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(first1 + 2), _mm_loadu_pd(first2 + 2)));
+				acc2 = _mm_add_pd(acc2, _mm_mul_pd(_mm_loadu_pd(first1 + 4), _mm_loadu_pd(first2 + 4)));
+				acc3 = _mm_add_pd(acc3, _mm_mul_pd(_mm_loadu_pd(first1 + 6), _mm_loadu_pd(first2 + 6)));
+			}
+			double lane[2];
+			_mm_storeu_pd(lane, _mm_add_pd(_mm_add_pd(acc0, acc1), _mm_add_pd(acc2, acc3)));
+			double sum = lane[0] + lane[1];
+			for (; first1 != last1; ++first1, ++first2)
+			{
+				sum += *first1 * *first2;
+			}
+			return init + sum;
+		}
+	};
+#endif
+
+	template <typename U1, typename U2, typename T, typename BinaryOperation1, typename BinaryOperation2>
+	inline T __transform_reduce(U1 *first1, U1 *last1, U2 *first2, T init,
+		BinaryOperation1 op1, BinaryOperation2 op2, random_access_iterator_tag)
+	{
+		return __dot_kernel<T, BinaryOperation1, BinaryOperation2>::apply(static_cast<const U1 *>(first1),
+			static_cast<const U1 *>(last1), static_cast<const U2 *>(first2), init, op1, op2);
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename T,
+		typename BinaryOperation1, typename BinaryOperation2>
+	inline T transform_reduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init,
+		BinaryOperation1 op1, BinaryOperation2 op2)
+	{
+		return __transform_reduce(first1, last1, first2, init, op1, op2, iterator_category(first1));
+	}
+
+	//点积
+	template <typename InputIterator1, typename InputIterator2, typename T>
+	inline T transform_reduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init)
+	{
+		return transform_reduce(first1, last1, first2, init, plus<T>(), multiplies<T>());
+	}
+
+	//单个区间：init op op2(a[0]) op op2(a[1]) ...
+	template <typename InputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+	T __transform_reduce_unary(InputIterator first, InputIterator last, T init,
+		BinaryOperation op, UnaryOperation uop, input_iterator_tag)
+	{
+		for (; first != last; ++first)
+		{
+			init = op(init, uop(*first));
+		}
+		return init;
+	}
+
+	template <typename RandomAccessIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+	T __transform_reduce_unary(RandomAccessIterator first, RandomAccessIterator last, T init,
+		BinaryOperation op, UnaryOperation uop, random_access_iterator_tag)
+	{
+		ptrdiff_t n = last - first;
+		if (n < 8)
+		{
+			return __transform_reduce_unary(first, last, init, op, uop, input_iterator_tag());
+		}
+		T acc0 = uop(first[0]);
+		T acc1 = uop(first[1]);
+		T acc2 = uop(first[2]);
+		T acc3 = uop(first[3]);
+		ptrdiff_t i = 4;
+		for (; i + 4 <= n; i += 4)
+		{
+			acc0 = op(acc0, uop(first[i]));
+			acc1 = op(acc1, uop(first[i + 1]));
+			acc2 = op(acc2, uop(first[i + 2]));
+			acc3 = op(acc3, uop(first[i + 3]));
+		}
+		for (; i < n; ++i)
+		{
+			acc0 = op(acc0, uop(first[i]));
+		}
+		return op(init, op(op(acc0, acc1), op(acc2, acc3)));
+	}
+
+	template <typename InputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+	inline T transform_reduce(InputIterator first, InputIterator last, T init,
+		BinaryOperation op, UnaryOperation uop)
+	{
+		return __transform_reduce_unary(first, last, init, op, uop, iterator_category(first));
+	}
+	//****************************************
+
+	//inclusive_scan / exclusive_scan
+	//****************************************
+	template <typename InputIterator, typename OutputIterator, typename BinaryOperation, typename T>
+	OutputIterator inclusive_scan(InputIterator first, InputIterator last, OutputIterator result,
+		BinaryOperation op, T init)
+	{
+		for (; first != last; ++first, ++result)
+		{
+			init = op(init, *first);
+			*result = init;
+		}
+		return result;
+	}
+
+	template <typename InputIterator, typename OutputIterator, typename BinaryOperation>
+	OutputIterator inclusive_scan(InputIterator first, InputIterator last, OutputIterator result,
+		BinaryOperation op)
+	{
+		if (first == last)
+		{
+			return result;
+		}
+		typename iterator_traits<InputIterator>::value_type sum = *first;
+		*result = sum;
+		++first, ++result;
+		return inclusive_scan(first, last, result, op, sum);
+	}
+
+	template <typename InputIterator, typename OutputIterator>
+	inline OutputIterator inclusive_scan(InputIterator first, InputIterator last, OutputIterator result)
+	{
+		using value = typename iterator_traits<InputIterator>::value_type;
+		return inclusive_scan(first, last, result, plus<value>());
+	}
+
+	//result可与first相同，故先读出*first再写入
+	template <typename InputIterator, typename OutputIterator, typename T, typename BinaryOperation>
+	OutputIterator exclusive_scan(InputIterator first, InputIterator last, OutputIterator result,
+		T init, BinaryOperation op)
+	{
+		for (; first != last; ++first, ++result)
+		{
+			T next = op(init, *first);
+			*result = init;
+			init = next;
+		}
+		return result;
+	}
+
+	template <typename InputIterator, typename OutputIterator, typename T>
+	inline OutputIterator exclusive_scan(InputIterator first, InputIterator last, OutputIterator result, T init)
+	{
+		return exclusive_scan(first, last, result, init, plus<T>());
+	}
+	//****************************************
+
+	//parallel_inclusive_scan / parallel_exclusive_scan
+	//****************************************
+	//two-pass：第一遍各线程求出自己一段的和，第二遍各线程带着前面各段之和扫描自己一段
+	//输入只读两次，输出只写一次；op须满足结合律
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename T, typename BinaryOperation>
+	RandomAccessIterator2 __parallel_scan(RandomAccessIterator1 first, RandomAccessIterator1 last,
+		RandomAccessIterator2 result, const T *init, BinaryOperation op, bool inclusive, unsigned thread_count)
+	{
+		ptrdiff_t n = last - first;
+		if (thread_count < 2 || n < __SCAN_PARALLEL_THRESHOLD)
+		{
+			if (inclusive)
+			{
+				return init ? inclusive_scan(first, last, result, op, *init) : inclusive_scan(first, last, result, op);
+			}
+			return exclusive_scan(first, last, result, *init, op);
+		}
+
+		//最后一段的和用不到，只需thread_count - 1个
+		T *partial = allocator<T>::allocate(thread_count - 1);
+		__parallel_run(thread_count - 1, [=](unsigned t)
+		{
+			RandomAccessIterator1 b = first + n * t / thread_count;
+			RandomAccessIterator1 e = first + n * (t + 1) / thread_count;
+			construct(partial + t, accumulate(b + 1, e, T(*b), op));    //op不要求交换律，须按顺序求和，不能用reduce
+		});
+
+		//partial[t]改为前t+1段之和（含init）
+		if (init)
+		{
+			partial[0] = op(*init, partial[0]);
+		}
+		for (unsigned t = 1; t + 1 < thread_count; ++t)
+		{
+			partial[t] = op(partial[t - 1], partial[t]);
+		}
+
+		__parallel_run(thread_count, [=](unsigned t)
+		{
+			RandomAccessIterator1 b = first + n * t / thread_count;
+			RandomAccessIterator1 e = first + n * (t + 1) / thread_count;
+			RandomAccessIterator2 out = result + n * t / thread_count;
+			if (t == 0 && !init)
+			{
+				inclusive_scan(b, e, out, op);
+			}
+			else if (inclusive)
+			{
+				inclusive_scan(b, e, out, op, t == 0 ? *init : partial[t - 1]);
+			}
+			else
+			{
+				exclusive_scan(b, e, out, t == 0 ? *init : partial[t - 1], op);
+			}
+		});
+
+		destroy(partial, partial + (thread_count - 1));
+		allocator<T>::deallocate(partial, thread_count - 1);
+		return result + n;
+	}
+
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryOperation>
+	inline RandomAccessIterator2 parallel_inclusive_scan(RandomAccessIterator1 first, RandomAccessIterator1 last,
+		RandomAccessIterator2 result, BinaryOperation op, unsigned thread_count)
+	{
+		using value = typename iterator_traits<RandomAccessIterator1>::value_type;
+		return __parallel_scan(first, last, result, static_cast<const value *>(0), op, true, thread_count);
+	}
+
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryOperation>
+	inline RandomAccessIterator2 parallel_inclusive_scan(RandomAccessIterator1 first, RandomAccessIterator1 last,
+		RandomAccessIterator2 result, BinaryOperation op)
+	{
+		return parallel_inclusive_scan(first, last, result, op, __default_thread_count());
+	}
+
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+	inline RandomAccessIterator2 parallel_inclusive_scan(RandomAccessIterator1 first, RandomAccessIterator1 last,
+		RandomAccessIterator2 result)
+	{
+		using value = typename iterator_traits<RandomAccessIterator1>::value_type;
+		return parallel_inclusive_scan(first, last, result, plus<value>());
+	}
+
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename T, typename BinaryOperation>
+	inline RandomAccessIterator2 parallel_exclusive_scan(RandomAccessIterator1 first, RandomAccessIterator1 last,
+		RandomAccessIterator2 result, T init, BinaryOperation op, unsigned thread_count)
+	{
+		return __parallel_scan(first, last, result, &init, op, false, thread_count);
+	}
+
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename T, typename BinaryOperation>
+	inline RandomAccessIterator2 parallel_exclusive_scan(RandomAccessIterator1 first, RandomAccessIterator1 last,
+		RandomAccessIterator2 result, T init, BinaryOperation op)
+	{
+		return parallel_exclusive_scan(first, last, result, init, op, __default_thread_count());
+	}
+
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename T>
+	inline RandomAccessIterator2 parallel_exclusive_scan(RandomAccessIterator1 first, RandomAccessIterator1 last,
+		RandomAccessIterator2 result, T init)
+	{
+		return parallel_exclusive_scan(first, last, result, init, plus<T>());
+	}
+	//****************************************
+
+	//adjacent_difference
+	//****************************************
+	template <typename InputIterator, typename OutputIterator, typename BinaryOperation>
+	OutputIterator adjacent_difference(InputIterator first, InputIterator last, OutputIterator result,
+		BinaryOperation op)
+	{
+		if (first == last)
+		{
+			return result;
+		}
+		typename iterator_traits<InputIterator>::value_type prev = *first;
+		*result = prev;
+		while (++first != last)
+		{
+			typename iterator_traits<InputIterator>::value_type cur = *first;
+			*++result = op(cur, prev);
+			prev = cur;
+		}
+		return ++result;
+	}
+
+	template <typename InputIterator, typename OutputIterator>
+	inline OutputIterator adjacent_difference(InputIterator first, InputIterator last, OutputIterator result)
+	{
+		using value = typename iterator_traits<InputIterator>::value_type;
+		return adjacent_difference(first, last, result, minus<value>());
+	}
+	//****************************************
+}
+
+#endif // !__NUMERIC_H
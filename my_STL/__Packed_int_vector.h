@@ -0,0 +1,530 @@
+#ifndef __PACKED_INT_VECTOR_H
+#define __PACKED_INT_VECTOR_H
+
+#include <string.h>         //memcpy
+#include "__Config.h"
+#include "__Iterator.h"
+#include "__Vector.h"
+
+#ifdef __STL_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace my_STL
+{
+	enum
+	{
+		__PACKED_BLOCK = 128,               //每块的元素个数
+		__PACKED_RAW = 0xff                 //块内差值超过32位时原样存放
+	};
+
+	enum packed_encoding
+	{
+		packed_fixed,                       //每块按块内最大值的位宽存放
+		packed_for,                         //frame of reference：存放与块内最小值之差
+		packed_delta                        //存放与前一个元素之差，适合有序的列
+	};
+
+	//位宽打包
+	//****************************************
+	//一块128个32位值按4路纵向排列：第j个值属于第j % 4路，每一路各自连续打包
+	//于是一个__m128i恰好装着4路的同一个字，4个相邻的值可以一起移位、掩码解出
+	inline unsigned __packed_bit_width(unsigned x)
+	{
+		unsigned w = 0;
+		for (; x; x >>= 1)
+		{
+			++w;
+		}
+		return w;
+	}
+
+	inline unsigned __packed_mask(unsigned width)
+	{
+		return width == 32 ? ~0u : (1u << width) - 1;
+	}
+
+	//把128个值按width位打包到out（须已清零，共4 * width个字）
+	inline void __packed_pack(const unsigned *in, unsigned width, unsigned *out)
+	{
+		for (unsigned j = 0; j != __PACKED_BLOCK; ++j)
+		{
+			const unsigned bit = (j >> 2) * width;
+			const unsigned index = (bit >> 5) * 4 + (j & 3);
+			const unsigned shift = bit & 31;
+			out[index] |= in[j] << shift;
+			if (shift + width > 32)
+			{
+				out[index + 4] |= in[j] >> (32 - shift);
+			}
+		}
+	}
+
+	//随机访问块内第j个值
+	inline unsigned __packed_get(const unsigned *in, unsigned width, unsigned j)
+	{
+		if (width == 0)
+		{
+			return 0;
+		}
+		const unsigned bit = (j >> 2) * width;
+		const unsigned index = (bit >> 5) * 4 + (j & 3);
+		const unsigned shift = bit & 31;
+		unsigned x = in[index] >> shift;
+		if (shift + width > 32)
+		{
+			x |= in[index + 4] << (32 - shift);
+		}
+		return x & __packed_mask(width);
+	}
+
+	//解出整块128个值
+	inline void __packed_unpack(const unsigned *in, unsigned width, unsigned *out)
+	{
+		if (width == 0)
+		{
+			memset(out, 0, __PACKED_BLOCK * sizeof(unsigned));
+			return;
+		}
+#ifdef __STL_USE_SSE2
+		const __m128i *p = reinterpret_cast<const __m128i *>(in);
+		const __m128i mask = _mm_set1_epi32(static_cast<int>(__packed_mask(width)));
+		__m128i cur = _mm_loadu_si128(p++);
+		unsigned shift = 0;
+		for (unsigned k = 0; k != __PACKED_BLOCK / 4; ++k)
+		{
+			__m128i v = _mm_srl_epi32(cur, _mm_cvtsi32_si128(static_cast<int>(shift)));
+			if (shift + width > 32)               //跨字：高位来自下一个字
+			{
+				cur = _mm_loadu_si128(p++);
+				v = _mm_or_si128(v, _mm_sll_epi32(cur, _mm_cvtsi32_si128(static_cast<int>(32 - shift))));
+			}
+			else if (shift + width == 32 && k + 1 != __PACKED_BLOCK / 4)
+			{
+				cur = _mm_loadu_si128(p++);
+			}
+			shift = (shift + width) & 31;
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out + 4 * k), _mm_and_si128(v, mask));
+		}
+#else
+		for (unsigned j = 0; j != __PACKED_BLOCK; ++j)
+		{
+			out[j] = __packed_get(in, width, j);
+		}
+#endif
+	}
+	//****************************************
+
+	//__packed_int_iterator
+	//****************************************
+	//只读，按下标经由operator[]取值；顺序扫描时for_each/decode更快
+	template <typename Container>
+	struct __packed_int_iterator
+	{
+		using iterator_category = random_access_iterator_tag;
+		using value_type = typename Container::value_type;
+		using difference_type = ptrdiff_t;
+		using pointer = void;
+		using reference = value_type;
+
+		const Container *c;
+		difference_type index;
+
+		__packed_int_iterator() :c(nullptr), index(0) {}
+		__packed_int_iterator(const Container *x, difference_type i) :c(x), index(i) {}
+
+		reference operator*() const
+		{
+			return (*c)[index];
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return (*c)[index + n];
+		}
+
+		bool operator==(const __packed_int_iterator &it) const
+		{
+			return index == it.index;
+		}
+
+		bool operator!=(const __packed_int_iterator &it) const
+		{
+			return index != it.index;
+		}
+
+		bool operator<(const __packed_int_iterator &it) const
+		{
+			return index < it.index;
+		}
+
+		bool operator>(const __packed_int_iterator &it) const
+		{
+			return it.index < index;
+		}
+
+		bool operator<=(const __packed_int_iterator &it) const
+		{
+			return !(it.index < index);
+		}
+
+		bool operator>=(const __packed_int_iterator &it) const
+		{
+			return !(index < it.index);
+		}
+
+		__packed_int_iterator &operator++()
+		{
+			++index;
+			return *this;
+		}
+
+		__packed_int_iterator operator++(int)
+		{
+			__packed_int_iterator temp = *this;
+			++index;
+			return temp;
+		}
+
+		__packed_int_iterator &operator--()
+		{
+			--index;
+			return *this;
+		}
+
+		__packed_int_iterator operator--(int)
+		{
+			__packed_int_iterator temp = *this;
+			--index;
+			return temp;
+		}
+
+		__packed_int_iterator &operator+=(difference_type n)
+		{
+			index += n;
+			return *this;
+		}
+
+		__packed_int_iterator &operator-=(difference_type n)
+		{
+			index -= n;
+			return *this;
+		}
+
+		__packed_int_iterator operator+(difference_type n) const
+		{
+			return __packed_int_iterator(c, index + n);
+		}
+
+		__packed_int_iterator operator-(difference_type n) const
+		{
+			return __packed_int_iterator(c, index - n);
+		}
+
+		difference_type operator-(const __packed_int_iterator &it) const
+		{
+			return index - it.index;
+		}
+	};
+	//****************************************
+
+	//packed_int_vector
+	//****************************************
+	//压缩存放的无符号整数序列，只能在尾端追加
+	//每满128个元素编码成一块，块内的值（或差值）按所需的最少位数打包；未满一块的尾部原样存放
+	//operator[]为O(1)（packed_delta需要块内前缀和，至多128次解包）；顺序扫描按块SIMD解码
+	template <typename T = unsigned int>
+	class packed_int_vector
+	{
+		static_assert(T(-1) > T(0) && (sizeof(T) == 4 || sizeof(T) == 8),
+			"packed_int_vector requires a 32 or 64 bit unsigned integer type");
+
+	public:
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using const_reference = T;
+		using const_iterator = __packed_int_iterator<packed_int_vector>;
+		using iterator = const_iterator;
+
+	protected:
+		struct block_header
+		{
+			T base;                //packed_fixed为0，packed_for为最小值，packed_delta为第一个值
+			size_type offset;      //在words中的起始位置
+			unsigned width;        //位宽，或__PACKED_RAW
+		};
+
+		vector<block_header> blocks;
+		vector<unsigned> words;
+		T tail[__PACKED_BLOCK];    //尚未编码的尾部
+		size_type tail_count;
+		packed_encoding enc;
+
+		void encode_block(const T *values);
+		void decode_block(size_type b, T *out) const;
+		T block_value(size_type b, unsigned j) const;
+
+	public:
+		explicit packed_int_vector(packed_encoding e = packed_for) :tail_count(0), enc(e) {}
+
+		template <typename InputIterator>
+		packed_int_vector(InputIterator first, InputIterator last, packed_encoding e = packed_for)
+			:tail_count(0), enc(e)
+		{
+			append(first, last);
+		}
+
+		packed_encoding encoding() const
+		{
+			return enc;
+		}
+
+		size_type size() const
+		{
+			return blocks.size() * __PACKED_BLOCK + tail_count;
+		}
+
+		bool empty() const
+		{
+			return size() == 0;
+		}
+
+		//压缩后占用的字节数（不含对象本身）
+		size_type bytes() const
+		{
+			return words.capacity() * sizeof(unsigned) + blocks.capacity() * sizeof(block_header);
+		}
+
+		const_iterator begin() const
+		{
+			return const_iterator(this, 0);
+		}
+
+		const_iterator end() const
+		{
+			return const_iterator(this, size());
+		}
+
+		T operator[](size_type n) const
+		{
+			const size_type b = n / __PACKED_BLOCK;
+			const unsigned j = static_cast<unsigned>(n % __PACKED_BLOCK);
+			return b == blocks.size() ? tail[j] : block_value(b, j);
+		}
+
+		T front() const
+		{
+			return (*this)[0];
+		}
+
+		T back() const
+		{
+			return (*this)[size() - 1];
+		}
+
+		void push_back(T x)
+		{
+			tail[tail_count++] = x;
+			if (tail_count == __PACKED_BLOCK)
+			{
+				encode_block(tail);
+				tail_count = 0;
+			}
+		}
+
+		template <typename InputIterator>
+		void append(InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+			{
+				push_back(*first);
+			}
+		}
+
+		void clear()
+		{
+			blocks.clear();
+			words.clear();
+			tail_count = 0;
+		}
+
+		void reserve(size_type n)
+		{
+			blocks.reserve(n / __PACKED_BLOCK);
+		}
+
+		//追加完毕后释放按增长策略多配置的空间
+		void shrink_to_fit()
+		{
+			blocks.shrink_to_fit();
+			words.shrink_to_fit();
+		}
+
+		//把[first, first + n)解码到out
+		void decode(size_type first, size_type n, T *out) const;
+
+		//按块解码后依次调用f
+		template <typename Function>
+		Function for_each(Function f) const;
+	};
+
+	/***********************************************************************/
+	//packed_int_vector
+	/***********************************************************************/
+	template <typename T>
+	void packed_int_vector<T>::encode_block(const T *values)
+	{
+		unsigned diff[__PACKED_BLOCK];
+		block_header h;
+		h.offset = words.size();
+		T base = 0;
+		if (enc == packed_for)
+		{
+			base = values[0];
+			for (unsigned j = 1; j != __PACKED_BLOCK; ++j)
+			{
+				base = values[j] < base ? values[j] : base;
+			}
+		}
+		else if (enc == packed_delta)
+		{
+			base = values[0];
+		}
+		h.base = base;
+
+		//差值都能放进32位时打包，否则整块原样存放
+		bool fits = true;
+		unsigned bits = 0;
+		T prev = base;
+		for (unsigned j = 0; j != __PACKED_BLOCK; ++j)
+		{
+			const T d = values[j] - (enc == packed_delta ? prev : base);
+			prev = values[j];
+			if (d > T(~0u))
+			{
+				fits = false;
+				break;
+			}
+			diff[j] = static_cast<unsigned>(d);
+			bits |= diff[j];
+		}
+
+		if (fits)
+		{
+			h.width = __packed_bit_width(bits);
+			words.resize(h.offset + 4 * h.width, 0u);
+			if (h.width != 0)
+			{
+				__packed_pack(diff, h.width, &words[h.offset]);
+			}
+		}
+		else
+		{
+			h.width = __PACKED_RAW;
+			words.resize_for_overwrite(h.offset + __PACKED_BLOCK * sizeof(T) / sizeof(unsigned));
+			memcpy(&words[h.offset], values, __PACKED_BLOCK * sizeof(T));
+		}
+		blocks.push_back(h);
+	}
+
+	template <typename T>
+	void packed_int_vector<T>::decode_block(size_type b, T *out) const
+	{
+		const block_header &h = blocks[b];
+		const unsigned *in = words.begin() + h.offset;
+		if (h.width == __PACKED_RAW)
+		{
+			memcpy(out, in, __PACKED_BLOCK * sizeof(T));
+			return;
+		}
+		unsigned diff[__PACKED_BLOCK];
+		__packed_unpack(in, h.width, diff);
+		if (enc == packed_delta)
+		{
+			T acc = h.base;
+			for (unsigned j = 0; j != __PACKED_BLOCK; ++j)
+			{
+				acc += diff[j];
+				out[j] = acc;
+			}
+		}
+		else
+		{
+			const T base = h.base;
+			for (unsigned j = 0; j != __PACKED_BLOCK; ++j)
+			{
+				out[j] = base + diff[j];
+			}
+		}
+	}
+
+	template <typename T>
+	T packed_int_vector<T>::block_value(size_type b, unsigned j) const
+	{
+		const block_header &h = blocks[b];
+		const unsigned *in = words.begin() + h.offset;
+		if (h.width == __PACKED_RAW)
+		{
+			T x;
+			memcpy(&x, in + j * (sizeof(T) / sizeof(unsigned)), sizeof(T));
+			return x;
+		}
+		if (enc != packed_delta)
+		{
+			return h.base + __packed_get(in, h.width, j);
+		}
+		T acc = h.base;
+		for (unsigned i = 1; i <= j; ++i)
+		{
+			acc += __packed_get(in, h.width, i);
+		}
+		return acc;
+	}
+
+	template <typename T>
+	void packed_int_vector<T>::decode(size_type first, size_type n, T *out) const
+	{
+		T buffer[__PACKED_BLOCK];
+		while (n != 0)
+		{
+			const size_type b = first / __PACKED_BLOCK;
+			const size_type j = first % __PACKED_BLOCK;
+			const T *src = tail;
+			if (b != blocks.size())
+			{
+				decode_block(b, buffer);
+				src = buffer;
+			}
+			size_type m = __PACKED_BLOCK - j;
+			m = m < n ? m : n;
+			memcpy(out, src + j, m * sizeof(T));
+			out += m;
+			first += m;
+			n -= m;
+		}
+	}
+
+	template <typename T>
+	template <typename Function>
+	Function packed_int_vector<T>::for_each(Function f) const
+	{
+		T buffer[__PACKED_BLOCK];
+		for (size_type b = 0; b != blocks.size(); ++b)
+		{
+			decode_block(b, buffer);
+			for (unsigned j = 0; j != __PACKED_BLOCK; ++j)
+			{
+				f(buffer[j]);
+			}
+		}
+		for (size_type j = 0; j != tail_count; ++j)
+		{
+			f(tail[j]);
+		}
+		return f;
+	}
+	//****************************************
+}
+
+#endif // !__PACKED_INT_VECTOR_H
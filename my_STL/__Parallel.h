@@ -0,0 +1,37 @@
+#ifndef __PARALLEL_H
+#define __PARALLEL_H
+
+#include <new>            //placement new
+#include <thread>
+#include "__Allocator.h"
+#include "__Construct.h"
+
+namespace my_STL
+{
+	//默认线程数，无法取得时为1
+	inline unsigned __default_thread_count()
+	{
+		unsigned n = std::thread::hardware_concurrency();
+		return n != 0 ? n : 1;
+	}
+
+	//在thread_count个线程上执行f(t)，t为线程编号，返回前等待全部结束
+	//alloc的free_list不是线程安全的，f中需要的空间应由调用者事先配置好
+	template <typename Function>
+	void __parallel_run(unsigned thread_count, Function f)
+	{
+		std::thread *workers = allocator<std::thread>::allocate(thread_count);
+		for (unsigned t = 0; t < thread_count; ++t)
+		{
+			new(workers + t) std::thread(f, t);
+		}
+		for (unsigned t = 0; t < thread_count; ++t)
+		{
+			workers[t].join();
+			destroy(workers + t);
+		}
+		allocator<std::thread>::deallocate(workers, thread_count);
+	}
+}
+
+#endif // !__PARALLEL_H
@@ -0,0 +1,102 @@
+#ifndef __PREFETCH_ITERATOR_H
+#define __PREFETCH_ITERATOR_H
+
+#include <type_traits>
+#include "__Config.h"
+#include "__Iterator.h"
+
+namespace my_STL
+{
+	enum
+	{
+		__LIST_PREFETCH_DISTANCE = 8         //链式遍历默认领先的节点数，list::for_each_prefetched也用它
+	};
+
+	//prefetch_iterator
+	//****************************************
+	//包装一个迭代器，另持一个领先distance步的迭代器，每前进一步就预取领先处的元素
+	//链式结构上领先迭代器本身仍是串行的依赖载入，但其延迟可与对当前元素的处理重叠
+	//至多为forward
+	template <typename Iterator>
+	class prefetch_iterator
+	{
+	public:
+		using iterator_category = typename std::conditional<
+			std::is_base_of<forward_iterator_tag, typename iterator_traits<Iterator>::iterator_category>::value,
+			forward_iterator_tag, input_iterator_tag>::type;
+		using value_type = typename iterator_traits<Iterator>::value_type;
+		using difference_type = typename iterator_traits<Iterator>::difference_type;
+		using pointer = typename iterator_traits<Iterator>::pointer;
+		using reference = typename iterator_traits<Iterator>::reference;
+
+	protected:
+		Iterator current;
+		Iterator ahead;                 //领先current若干步，到last为止
+		Iterator last;
+
+	public:
+		prefetch_iterator() :current(), ahead(), last() {}
+
+		prefetch_iterator(Iterator first, Iterator l, difference_type distance) :current(first), ahead(first), last(l)
+		{
+			for (; distance > 0 && ahead != last; --distance)
+			{
+				++ahead;
+			}
+		}
+
+		Iterator base() const
+		{
+			return current;
+		}
+
+		reference operator*() const
+		{
+			return *current;
+		}
+
+		pointer operator->() const
+		{
+			return &*current;
+		}
+
+		bool operator==(const prefetch_iterator &it) const
+		{
+			return current == it.current;
+		}
+
+		bool operator!=(const prefetch_iterator &it) const
+		{
+			return !(*this == it);
+		}
+
+		prefetch_iterator &operator++()
+		{
+			++current;
+			if (ahead != last)
+			{
+				__STL_PREFETCH(&*ahead);
+				++ahead;
+			}
+			return *this;
+		}
+
+		prefetch_iterator operator++(int)
+		{
+			prefetch_iterator temp = *this;
+			++*this;
+			return temp;
+		}
+	};
+
+	//[make_prefetch_iterator(first, last, d), make_prefetch_iterator(last, last, 0))
+	template <typename Iterator>
+	inline prefetch_iterator<Iterator> make_prefetch_iterator(Iterator first, Iterator last,
+		typename iterator_traits<Iterator>::difference_type distance = __LIST_PREFETCH_DISTANCE)
+	{
+		return prefetch_iterator<Iterator>(first, last, distance);
+	}
+	//****************************************
+}
+
+#endif // !__PREFETCH_ITERATOR_H
@@ -0,0 +1,494 @@
+#ifndef __RADIX_SORT_H
+#define __RADIX_SORT_H
+
+#include <string.h>        //memset memcpy
+#include <wchar.h>         //WCHAR_MIN
+#include <atomic>
+#include <climits>         //CHAR_MIN
+#include <type_traits>
+#include "__Allocator.h"
+#include "__Construct.h"
+#include "__Iterator.h"
+#include "__Parallel.h"
+#include "__Type_traits.h"
+#include "__Uninitialized.h"
+
+namespace my_STL
+{
+	//radix key traits: 把键映射为保序的无符号整数
+	//****************************************
+	template <typename U>
+	struct __radix_unsigned_key
+	{
+		using unsigned_type = U;
+		static U encode(U k)
+		{
+			return k;
+		}
+	};
+
+	template <typename S, typename U>
+	struct __radix_signed_key
+	{
+		using unsigned_type = U;
+		static U encode(S k)              //翻转符号位，负数排在前面
+		{
+			return static_cast<U>(k) ^ (U(1) << (sizeof(U) * 8 - 1));
+		}
+	};
+
+	//K按值转换为U，保序
+	template <typename K, typename U>
+	struct __radix_cast_key
+	{
+		using unsigned_type = U;
+		static U encode(K k)
+		{
+			return static_cast<U>(k);
+		}
+	};
+
+	//与N字节等宽的无符号整数
+	template <size_t N>
+	struct __radix_unsigned_of;
+
+	template <>
+	struct __radix_unsigned_of<1>
+	{
+		using type = unsigned char;
+	};
+
+	template <>
+	struct __radix_unsigned_of<2>
+	{
+		using type = unsigned short;
+	};
+
+	template <>
+	struct __radix_unsigned_of<4>
+	{
+		using type = unsigned int;
+	};
+
+	template <>
+	struct __radix_unsigned_of<8>
+	{
+		using type = unsigned long long;
+	};
+
+	//字符类型：按实际有无符号选用有符号键或无符号键
+	template <typename C, bool Signed>
+	struct __radix_char_key :public std::conditional<Signed,
+		__radix_signed_key<C, typename __radix_unsigned_of<sizeof(C)>::type>,
+		__radix_cast_key<C, typename __radix_unsigned_of<sizeof(C)>::type>>::type {};
+
+	template <typename Key>
+	struct __radix_key_traits;
+
+	template <>
+	struct __radix_key_traits<bool> :public __radix_cast_key<bool, unsigned char> {};
+
+	template <>
+	struct __radix_key_traits<char> :public __radix_char_key<char, (CHAR_MIN < 0)> {};
+
+	template <>
+	struct __radix_key_traits<wchar_t> :public __radix_char_key<wchar_t, (WCHAR_MIN < 0)> {};
+
+	template <>
+	struct __radix_key_traits<char16_t> :public __radix_char_key<char16_t, false> {};
+
+	template <>
+	struct __radix_key_traits<char32_t> :public __radix_char_key<char32_t, false> {};
+
+	template <>
+	struct __radix_key_traits<unsigned char> :public __radix_unsigned_key<unsigned char> {};
+
+	template <>
+	struct __radix_key_traits<unsigned short> :public __radix_unsigned_key<unsigned short> {};
+
+	template <>
+	struct __radix_key_traits<unsigned int> :public __radix_unsigned_key<unsigned int> {};
+
+	template <>
+	struct __radix_key_traits<unsigned long> :public __radix_unsigned_key<unsigned long> {};
+
+	template <>
+	struct __radix_key_traits<unsigned long long> :public __radix_unsigned_key<unsigned long long> {};
+
+	template <>
+	struct __radix_key_traits<signed char> :public __radix_signed_key<signed char, unsigned char> {};
+
+	template <>
+	struct __radix_key_traits<short> :public __radix_signed_key<short, unsigned short> {};
+
+	template <>
+	struct __radix_key_traits<int> :public __radix_signed_key<int, unsigned int> {};
+
+	template <>
+	struct __radix_key_traits<long> :public __radix_signed_key<long, unsigned long> {};
+
+	template <>
+	struct __radix_key_traits<long long> :public __radix_signed_key<long long, unsigned long long> {};
+
+	template <>
+	struct __radix_key_traits<float>
+	{
+		using unsigned_type = unsigned int;
+		static unsigned int encode(float k)
+		{
+			unsigned int u;
+			memcpy(&u, &k, sizeof(u));
+			//负数全部取反，非负数翻转符号位
+			return (u & 0x80000000u) ? ~u : (u | 0x80000000u);
+		}
+	};
+
+	template <>
+	struct __radix_key_traits<double>
+	{
+		using unsigned_type = unsigned long long;
+		static unsigned long long encode(double k)
+		{
+			unsigned long long u;
+			memcpy(&u, &k, sizeof(u));
+			return (u & 0x8000000000000000ull) ? ~u : (u | 0x8000000000000000ull);
+		}
+	};
+	//****************************************
+
+	//radix_sort 内部实现
+	//****************************************
+	enum
+	{
+		__RADIX_INSERTION_THRESHOLD = 64,            //小于此长度时用插入排序
+		__RADIX_PARALLEL_THRESHOLD = 1 << 16,        //小于此长度时不开线程
+		__RADIX_MSD_BITS = 8                         //并行版本首轮MSD的位数
+	};
+
+	//默认键：元素本身
+	template <typename T>
+	struct __radix_identity
+	{
+		const T &operator()(const T &x) const
+		{
+			return x;
+		}
+	};
+
+	//从键函数的返回值推导键类型
+	template <typename K>
+	inline K *__radix_key_type(const K &)
+	{
+		return static_cast<K *>(0);
+	}
+
+	//每轮位数：16位以内的键用8位，更宽的键用11位（32位键只需3轮）
+	template <typename K>
+	inline int __radix_digit_bits(K*)
+	{
+		return sizeof(typename __radix_key_traits<K>::unsigned_type) <= 2 ? 8 : 11;
+	}
+
+	template <typename K>
+	inline int __radix_key_bits(K*)
+	{
+		return static_cast<int>(sizeof(typename __radix_key_traits<K>::unsigned_type) * 8);
+	}
+
+	template <typename RandomAccessIterator, typename KeyFunction, typename K>
+	inline typename __radix_key_traits<K>::unsigned_type
+	__radix_encode(RandomAccessIterator i, KeyFunction &key, K*)
+	{
+		return __radix_key_traits<K>::encode(key(*i));
+	}
+
+	//按编码后的键做稳定插入排序
+	template <typename RandomAccessIterator, typename KeyFunction, typename K>
+	void __radix_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, KeyFunction &key, K*)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		if (first == last) return;
+		for (RandomAccessIterator i = first + 1; i != last; ++i)
+		{
+			value v = *i;
+			typename __radix_key_traits<K>::unsigned_type k = __radix_key_traits<K>::encode(key(v));
+			RandomAccessIterator j = i;
+			for (; j != first && k < __radix_encode(j - 1, key, (K*)0); --j)
+			{
+				*j = *(j - 1);
+			}
+			*j = v;
+		}
+	}
+
+	//按一位分发元素, offset为各桶的起始位置
+	template <typename InputIterator, typename OutputIterator, typename KeyFunction, typename K>
+	void __radix_scatter(InputIterator src, ptrdiff_t n, OutputIterator dst, size_t *offset,
+		int shift, size_t mask, KeyFunction &key, K*)
+	{
+		for (ptrdiff_t i = 0; i < n; ++i)
+		{
+			size_t d = static_cast<size_t>(__radix_encode(src + i, key, (K*)0) >> shift) & mask;
+			dst[offset[d]++] = src[i];
+		}
+	}
+
+	//LSD: 对[a, a+n)的低key_bits位排序，b为同样大小的辅助空间
+	//count至少有 passes * 2^bits 个元素
+	//返回true表示结果在b中
+	template <typename Iterator1, typename Iterator2, typename KeyFunction, typename K>
+	bool __radix_sort_lsd(Iterator1 a, Iterator2 b, ptrdiff_t n, int key_bits, size_t *count,
+		KeyFunction &key, K*)
+	{
+		const int bits = __radix_digit_bits((K*)0);
+		const size_t radix = size_t(1) << bits;
+		const size_t mask = radix - 1;
+		const int passes = (key_bits + bits - 1) / bits;
+
+		//直方图：一次遍历统计所有位
+		memset(count, 0, sizeof(size_t) * radix * passes);
+		for (ptrdiff_t i = 0; i < n; ++i)
+		{
+			typename __radix_key_traits<K>::unsigned_type k = __radix_encode(a + i, key, (K*)0);
+			for (int p = 0; p < passes; ++p)
+			{
+				++count[p * radix + (static_cast<size_t>(k >> (p * bits)) & mask)];
+			}
+		}
+
+		bool in_b = false;
+		for (int p = 0; p < passes; ++p)
+		{
+			size_t *c = count + p * radix;
+			const int shift = p * bits;
+
+			//该位所有元素都相同，跳过此轮
+			size_t d0 = in_b ? static_cast<size_t>(__radix_encode(b, key, (K*)0) >> shift) & mask
+				: static_cast<size_t>(__radix_encode(a, key, (K*)0) >> shift) & mask;
+			if (c[d0] == static_cast<size_t>(n)) continue;
+
+			size_t sum = 0;
+			for (size_t d = 0; d < radix; ++d)
+			{
+				size_t t = c[d];
+				c[d] = sum;
+				sum += t;
+			}
+
+			if (in_b)
+			{
+				__radix_scatter(b, n, a, c, shift, mask, key, (K*)0);
+			}
+			else
+			{
+				__radix_scatter(a, n, b, c, shift, mask, key, (K*)0);
+			}
+			in_b = !in_b;
+		}
+		return in_b;
+	}
+
+	//POD型别的辅助空间不需要构造
+	template <typename RandomAccessIterator, typename T>
+	inline void __radix_buffer_init(RandomAccessIterator, RandomAccessIterator, T*, __true_type) {}
+
+	template <typename RandomAccessIterator, typename T>
+	inline void __radix_buffer_init(RandomAccessIterator first, RandomAccessIterator last, T *buf, __false_type)
+	{
+		uninitialized_copy(first, last, buf);
+	}
+
+	template <typename RandomAccessIterator, typename KeyFunction, typename T, typename K>
+	void __radix_sort(RandomAccessIterator first, RandomAccessIterator last, KeyFunction &key, T*, K*)
+	{
+		ptrdiff_t n = last - first;
+		if (n < __RADIX_INSERTION_THRESHOLD)
+		{
+			__radix_insertion_sort(first, last, key, (K*)0);
+			return;
+		}
+
+		const int bits = __radix_digit_bits((K*)0);
+		const int key_bits = __radix_key_bits((K*)0);
+		const size_t count_size = (size_t(1) << bits) * ((key_bits + bits - 1) / bits);
+
+		T *buf = allocator<T>::allocate(n);
+		size_t *count = allocator<size_t>::allocate(count_size);
+		using is_POD = typename __type_traits<T>::is_POD_type;
+		__radix_buffer_init(first, last, buf, is_POD());
+
+		if (__radix_sort_lsd(first, buf, n, key_bits, count, key, (K*)0))
+		{
+			copy(buf, buf + n, first);
+		}
+
+		destroy(buf, buf + n);
+		allocator<size_t>::deallocate(count, count_size);
+		allocator<T>::deallocate(buf, n);
+	}
+
+	//并行版本：先在键的最高有效位上做一轮8位MSD分桶（各线程统计/分发自己的一段），
+	//再由各线程领取桶，在桶内对剩余低位做LSD
+	template <typename RandomAccessIterator, typename KeyFunction, typename T, typename K>
+	void __parallel_radix_sort(RandomAccessIterator first, RandomAccessIterator last, KeyFunction &key,
+		unsigned thread_count, T*, K*)
+	{
+		using unsigned_key = typename __radix_key_traits<K>::unsigned_type;
+		ptrdiff_t n = last - first;
+		if (thread_count < 2 || n < __RADIX_PARALLEL_THRESHOLD)
+		{
+			__radix_sort(first, last, key, (T*)0, (K*)0);
+			return;
+		}
+
+		const size_t buckets = size_t(1) << __RADIX_MSD_BITS;
+		const int bits = __radix_digit_bits((K*)0);
+		const int max_passes = (__radix_key_bits((K*)0) + bits - 1) / bits;
+		const size_t lsd_count_size = (size_t(1) << bits) * max_passes;
+		const size_t hist_size = buckets * thread_count;
+
+		//alloc的free_list不是线程安全的，所有空间都在主线程中配置
+		unsigned_key *diff = allocator<unsigned_key>::allocate(thread_count);
+		size_t *hist = allocator<size_t>::allocate(hist_size);
+		size_t *bucket_start = allocator<size_t>::allocate(buckets + 1);
+		size_t *lsd_count = allocator<size_t>::allocate(lsd_count_size * thread_count);
+		memset(hist, 0, sizeof(size_t) * hist_size);
+
+		//找出键中最高的不同位，高于它的位都不需要排序
+		const unsigned_key k0 = __radix_encode(first, key, (K*)0);
+		__parallel_run(thread_count, [=, &key](unsigned t)
+		{
+			unsigned_key d = 0;
+			for (ptrdiff_t i = n * t / thread_count; i < n * (t + 1) / thread_count; ++i)
+			{
+				d |= __radix_encode(first + i, key, (K*)0) ^ k0;
+			}
+			diff[t] = d;
+		});
+		unsigned_key all_diff = 0;
+		for (unsigned t = 0; t < thread_count; ++t)
+		{
+			all_diff |= diff[t];
+		}
+		int low_bits = 0;
+		while (low_bits < __radix_key_bits((K*)0) && (all_diff >> low_bits) != 0)
+		{
+			++low_bits;
+		}
+		low_bits = low_bits > __RADIX_MSD_BITS ? low_bits - __RADIX_MSD_BITS : 0;
+
+		if (all_diff != 0)
+		{
+			T *buf = allocator<T>::allocate(n);
+			using is_POD = typename __type_traits<T>::is_POD_type;
+			__radix_buffer_init(first, last, buf, is_POD());
+
+			//各线程统计自己一段的最高位直方图
+			__parallel_run(thread_count, [=, &key](unsigned t)
+			{
+				size_t *h = hist + t * buckets;
+				for (ptrdiff_t i = n * t / thread_count; i < n * (t + 1) / thread_count; ++i)
+				{
+					++h[static_cast<size_t>(__radix_encode(first + i, key, (K*)0) >> low_bits) & (buckets - 1)];
+				}
+			});
+
+			//按 (桶, 线程) 顺序计算偏移，保证稳定
+			size_t sum = 0;
+			for (size_t d = 0; d < buckets; ++d)
+			{
+				bucket_start[d] = sum;
+				for (unsigned t = 0; t < thread_count; ++t)
+				{
+					size_t c = hist[t * buckets + d];
+					hist[t * buckets + d] = sum;
+					sum += c;
+				}
+			}
+			bucket_start[buckets] = sum;
+
+			//各线程把自己一段分发到buf
+			__parallel_run(thread_count, [=, &key](unsigned t)
+			{
+				ptrdiff_t b = n * t / thread_count;
+				ptrdiff_t e = n * (t + 1) / thread_count;
+				__radix_scatter(first + b, e - b, buf, hist + t * buckets, low_bits, buckets - 1, key, (K*)0);
+			});
+
+			//各线程领取桶，排序低位后写回原区间
+			std::atomic<size_t> next_bucket(0);
+			__parallel_run(thread_count, [=, &key, &next_bucket](unsigned t)
+			{
+				size_t *count = lsd_count + t * lsd_count_size;
+				for (size_t d = next_bucket++; d < buckets; d = next_bucket++)
+				{
+					ptrdiff_t b = static_cast<ptrdiff_t>(bucket_start[d]);
+					ptrdiff_t m = static_cast<ptrdiff_t>(bucket_start[d + 1]) - b;
+					if (m == 0) continue;
+					if (m < __RADIX_INSERTION_THRESHOLD)
+					{
+						__radix_insertion_sort(buf + b, buf + b + m, key, (K*)0);
+						copy(buf + b, buf + b + m, first + b);
+					}
+					else if (!__radix_sort_lsd(buf + b, first + b, m, low_bits, count, key, (K*)0))
+					{
+						copy(buf + b, buf + b + m, first + b);
+					}
+				}
+			});
+
+			destroy(buf, buf + n);
+			allocator<T>::deallocate(buf, n);
+		}
+
+		allocator<size_t>::deallocate(lsd_count, lsd_count_size * thread_count);
+		allocator<size_t>::deallocate(bucket_start, buckets + 1);
+		allocator<size_t>::deallocate(hist, hist_size);
+		allocator<unsigned_key>::deallocate(diff, thread_count);
+	}
+	//****************************************
+
+	//radix_sort
+	//稳定排序；元素本身或key(元素)须为整数或浮点数
+	//****************************************
+	template <typename RandomAccessIterator, typename KeyFunction>
+	inline void radix_sort(RandomAccessIterator first, RandomAccessIterator last, KeyFunction key)
+	{
+		if (last - first < 2) return;
+		__radix_sort(first, last, key, value_type(first), __radix_key_type(key(*first)));
+	}
+
+	template <typename RandomAccessIterator>
+	inline void radix_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		radix_sort(first, last, __radix_identity<value>());
+	}
+	//****************************************
+
+	//parallel_radix_sort
+	//****************************************
+	template <typename RandomAccessIterator, typename KeyFunction>
+	inline void parallel_radix_sort(RandomAccessIterator first, RandomAccessIterator last, KeyFunction key,
+		unsigned thread_count)
+	{
+		if (last - first < 2) return;
+		__parallel_radix_sort(first, last, key, thread_count, value_type(first), __radix_key_type(key(*first)));
+	}
+
+	template <typename RandomAccessIterator, typename KeyFunction>
+	inline void parallel_radix_sort(RandomAccessIterator first, RandomAccessIterator last, KeyFunction key)
+	{
+		parallel_radix_sort(first, last, key, __default_thread_count());
+	}
+
+	template <typename RandomAccessIterator>
+	inline void parallel_radix_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		parallel_radix_sort(first, last, __radix_identity<value>());
+	}
+	//****************************************
+}
+
+#endif // !__RADIX_SORT_H
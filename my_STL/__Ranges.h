@@ -0,0 +1,1345 @@
+#ifndef __RANGES_H
+#define __RANGES_H
+
+#include <type_traits>
+#include <utility>          //pair declval forward
+#include "__Algorithm.h"
+#include "__Iterator.h"
+#include "__Vector.h"
+
+namespace my_STL
+{
+	//view基础设施
+	//****************************************
+	//所有view都派生自__view_base；view只保存底层view与参数，复制为O(1)，不配置内存
+	struct __view_base {};
+
+	//两种迭代器类型中较弱者
+	template <typename Category1, typename Category2>
+	struct __weaker_category
+	{
+		using type = typename std::conditional<std::is_base_of<Category2, Category1>::value,
+			Category2, Category1>::type;
+	};
+
+	//区间的迭代器类型（去掉const_iterator可能带的顶层const）
+	template <typename Range>
+	struct __range_iterator
+	{
+		using type = typename std::decay<decltype(std::declval<Range &>().begin())>::type;
+	};
+
+	//subrange：一对迭代器
+	template <typename Iterator>
+	class subrange :public __view_base
+	{
+	public:
+		using iterator = Iterator;
+
+	protected:
+		Iterator first;
+		Iterator last;
+
+	public:
+		subrange() :first(), last() {}
+		subrange(Iterator f, Iterator l) :first(f), last(l) {}
+
+		iterator begin() const
+		{
+			return first;
+		}
+
+		iterator end() const
+		{
+			return last;
+		}
+
+		bool empty() const
+		{
+			return first == last;
+		}
+	};
+
+	//ref_view：引用一个容器，容器须比view活得久
+	template <typename Range>
+	class ref_view :public __view_base
+	{
+	public:
+		using iterator = typename __range_iterator<Range>::type;
+
+	protected:
+		Range *r;
+
+	public:
+		explicit ref_view(Range &range) :r(&range) {}
+
+		iterator begin() const
+		{
+			return r->begin();
+		}
+
+		iterator end() const
+		{
+			return r->end();
+		}
+	};
+
+	//view原样复制，容器包装成ref_view
+	template <typename Range,
+		bool IsView = std::is_base_of<__view_base, typename std::decay<Range>::type>::value>
+	struct __all_result
+	{
+		using type = typename std::decay<Range>::type;
+	};
+
+	template <typename Range>
+	struct __all_result<Range, false>
+	{
+		static_assert(std::is_lvalue_reference<Range>::value, "cannot build a view over a temporary container");
+		using type = ref_view<typename std::remove_reference<Range>::type>;
+	};
+
+	template <typename Range>
+	inline typename __all_result<Range>::type __all(Range &&r)
+	{
+		return typename __all_result<Range>::type(r);
+	}
+
+	//r | adaptor
+	template <typename Function>
+	struct __range_adaptor
+	{
+		Function fn;
+		explicit __range_adaptor(const Function &f) :fn(f) {}
+	};
+
+	template <typename Range, typename Function>
+	inline auto operator|(Range &&r, const __range_adaptor<Function> &a) -> decltype(a.fn(__all(std::forward<Range>(r))))
+	{
+		return a.fn(__all(std::forward<Range>(r)));
+	}
+	//****************************************
+
+	//filter_view
+	//****************************************
+	template <typename View, typename Predicate>
+	class filter_view;
+
+	//至多为bidirectional
+	template <typename View, typename Predicate>
+	struct __filter_iterator
+	{
+		using base_iterator = typename View::iterator;
+		using iterator_category = typename __weaker_category<
+			typename iterator_traits<base_iterator>::iterator_category, bidirectional_iterator_tag>::type;
+		using value_type = typename iterator_traits<base_iterator>::value_type;
+		using difference_type = typename iterator_traits<base_iterator>::difference_type;
+		using pointer = typename iterator_traits<base_iterator>::pointer;
+		using reference = typename iterator_traits<base_iterator>::reference;
+
+		base_iterator current;
+		base_iterator last;
+		const filter_view<View, Predicate> *parent;
+
+		__filter_iterator() :current(), last(), parent(nullptr) {}
+		__filter_iterator(base_iterator c, base_iterator l, const filter_view<View, Predicate> *p)
+			:current(c), last(l), parent(p) {}
+
+		reference operator*() const
+		{
+			return *current;
+		}
+
+		bool operator==(const __filter_iterator &it) const
+		{
+			return current == it.current;
+		}
+
+		bool operator!=(const __filter_iterator &it) const
+		{
+			return !(*this == it);
+		}
+
+		__filter_iterator &operator++()
+		{
+			do
+			{
+				++current;
+			} while (current != last && !parent->predicate()(*current));
+			return *this;
+		}
+
+		__filter_iterator operator++(int)
+		{
+			__filter_iterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		__filter_iterator &operator--()
+		{
+			do
+			{
+				--current;
+			} while (!parent->predicate()(*current));
+			return *this;
+		}
+
+		__filter_iterator operator--(int)
+		{
+			__filter_iterator temp = *this;
+			--*this;
+			return temp;
+		}
+	};
+
+	template <typename View, typename Predicate>
+	class filter_view :public __view_base
+	{
+	public:
+		using iterator = __filter_iterator<View, Predicate>;
+
+	protected:
+		View base;
+		Predicate pred;
+
+	public:
+		filter_view(const View &v, const Predicate &p) :base(v), pred(p) {}
+
+		const Predicate &predicate() const
+		{
+			return pred;
+		}
+
+		//需找到第一个满足条件的元素，每次调用为O(n)
+		iterator begin() const
+		{
+			typename View::iterator first = base.begin();
+			typename View::iterator last = base.end();
+			while (first != last && !pred(*first))
+			{
+				++first;
+			}
+			return iterator(first, last, this);
+		}
+
+		iterator end() const
+		{
+			typename View::iterator last = base.end();
+			return iterator(last, last, this);
+		}
+	};
+
+	template <typename Predicate>
+	struct __filter_fn
+	{
+		Predicate pred;
+		explicit __filter_fn(const Predicate &p) :pred(p) {}
+
+		template <typename View>
+		filter_view<View, Predicate> operator()(const View &v) const
+		{
+			return filter_view<View, Predicate>(v, pred);
+		}
+	};
+	//****************************************
+
+	//transform_view
+	//****************************************
+	template <typename View, typename Function>
+	class transform_view;
+
+	//与底层迭代器类型相同
+	template <typename View, typename Function>
+	struct __transform_iterator
+	{
+		using base_iterator = typename View::iterator;
+		using iterator_category = typename iterator_traits<base_iterator>::iterator_category;
+		using reference = decltype(std::declval<const Function &>()(*std::declval<base_iterator>()));
+		using value_type = typename std::decay<reference>::type;
+		using difference_type = typename iterator_traits<base_iterator>::difference_type;
+		using pointer = void;
+
+		base_iterator current;
+		const transform_view<View, Function> *parent;
+
+		__transform_iterator() :current(), parent(nullptr) {}
+		__transform_iterator(base_iterator c, const transform_view<View, Function> *p) :current(c), parent(p) {}
+
+		reference operator*() const
+		{
+			return parent->function()(*current);
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return parent->function()(current[n]);
+		}
+
+		bool operator==(const __transform_iterator &it) const
+		{
+			return current == it.current;
+		}
+
+		bool operator!=(const __transform_iterator &it) const
+		{
+			return !(*this == it);
+		}
+
+		bool operator<(const __transform_iterator &it) const
+		{
+			return current < it.current;
+		}
+
+		bool operator>(const __transform_iterator &it) const
+		{
+			return it < *this;
+		}
+
+		bool operator<=(const __transform_iterator &it) const
+		{
+			return !(it < *this);
+		}
+
+		bool operator>=(const __transform_iterator &it) const
+		{
+			return !(*this < it);
+		}
+
+		__transform_iterator &operator++()
+		{
+			++current;
+			return *this;
+		}
+
+		__transform_iterator operator++(int)
+		{
+			__transform_iterator temp = *this;
+			++current;
+			return temp;
+		}
+
+		__transform_iterator &operator--()
+		{
+			--current;
+			return *this;
+		}
+
+		__transform_iterator operator--(int)
+		{
+			__transform_iterator temp = *this;
+			--current;
+			return temp;
+		}
+
+		__transform_iterator &operator+=(difference_type n)
+		{
+			current += n;
+			return *this;
+		}
+
+		__transform_iterator &operator-=(difference_type n)
+		{
+			current -= n;
+			return *this;
+		}
+
+		__transform_iterator operator+(difference_type n) const
+		{
+			return __transform_iterator(current + n, parent);
+		}
+
+		__transform_iterator operator-(difference_type n) const
+		{
+			return __transform_iterator(current - n, parent);
+		}
+
+		difference_type operator-(const __transform_iterator &it) const
+		{
+			return current - it.current;
+		}
+	};
+
+	template <typename View, typename Function>
+	class transform_view :public __view_base
+	{
+	public:
+		using iterator = __transform_iterator<View, Function>;
+
+	protected:
+		View base;
+		Function fn;
+
+	public:
+		transform_view(const View &v, const Function &f) :base(v), fn(f) {}
+
+		const Function &function() const
+		{
+			return fn;
+		}
+
+		iterator begin() const
+		{
+			return iterator(base.begin(), this);
+		}
+
+		iterator end() const
+		{
+			return iterator(base.end(), this);
+		}
+	};
+
+	template <typename Function>
+	struct __transform_fn
+	{
+		Function fn;
+		explicit __transform_fn(const Function &f) :fn(f) {}
+
+		template <typename View>
+		transform_view<View, Function> operator()(const View &v) const
+		{
+			return transform_view<View, Function>(v, fn);
+		}
+	};
+	//****************************************
+
+	//take_view
+	//****************************************
+	//非random access时带计数，至多为forward
+	template <typename Iterator>
+	struct __counted_iterator
+	{
+		using iterator_category = typename __weaker_category<
+			typename iterator_traits<Iterator>::iterator_category, forward_iterator_tag>::type;
+		using value_type = typename iterator_traits<Iterator>::value_type;
+		using difference_type = typename iterator_traits<Iterator>::difference_type;
+		using pointer = typename iterator_traits<Iterator>::pointer;
+		using reference = typename iterator_traits<Iterator>::reference;
+
+		Iterator current;
+		difference_type count;              //剩余个数
+
+		__counted_iterator() :current(), count(0) {}
+		__counted_iterator(Iterator c, difference_type n) :current(c), count(n) {}
+
+		reference operator*() const
+		{
+			return *current;
+		}
+
+		//计数用完或底层区间先结束
+		bool operator==(const __counted_iterator &it) const
+		{
+			return count == it.count || current == it.current;
+		}
+
+		bool operator!=(const __counted_iterator &it) const
+		{
+			return !(*this == it);
+		}
+
+		__counted_iterator &operator++()
+		{
+			++current;
+			--count;
+			return *this;
+		}
+
+		__counted_iterator operator++(int)
+		{
+			__counted_iterator temp = *this;
+			++*this;
+			return temp;
+		}
+	};
+
+	template <typename Iterator, typename Category = typename iterator_traits<Iterator>::iterator_category>
+	struct __take_traits
+	{
+		using iterator = __counted_iterator<Iterator>;
+		using difference_type = typename iterator_traits<Iterator>::difference_type;
+
+		static iterator begin(Iterator first, Iterator, difference_type n)
+		{
+			return iterator(first, n);
+		}
+
+		static iterator end(Iterator, Iterator last, difference_type)
+		{
+			return iterator(last, 0);
+		}
+	};
+
+	//random access时直接使用底层迭代器
+	template <typename Iterator>
+	struct __take_traits<Iterator, random_access_iterator_tag>
+	{
+		using iterator = Iterator;
+		using difference_type = typename iterator_traits<Iterator>::difference_type;
+
+		static iterator begin(Iterator first, Iterator, difference_type)
+		{
+			return first;
+		}
+
+		static iterator end(Iterator first, Iterator last, difference_type n)
+		{
+			return first + my_STL::min(n, difference_type(last - first));
+		}
+	};
+
+	template <typename View>
+	class take_view :public __view_base
+	{
+	protected:
+		using traits = __take_traits<typename View::iterator>;
+
+	public:
+		using iterator = typename traits::iterator;
+		using difference_type = typename traits::difference_type;
+
+	protected:
+		View base;
+		difference_type count;
+
+	public:
+		take_view(const View &v, difference_type n) :base(v), count(n) {}
+
+		iterator begin() const
+		{
+			return traits::begin(base.begin(), base.end(), count);
+		}
+
+		iterator end() const
+		{
+			return traits::end(base.begin(), base.end(), count);
+		}
+	};
+
+	struct __take_fn
+	{
+		ptrdiff_t count;
+		explicit __take_fn(ptrdiff_t n) :count(n) {}
+
+		template <typename View>
+		take_view<View> operator()(const View &v) const
+		{
+			return take_view<View>(v, count);
+		}
+	};
+	//****************************************
+
+	//drop_view
+	//****************************************
+	template <typename InputIterator, typename Distance>
+	inline InputIterator __drop_begin(InputIterator first, InputIterator last, Distance n, input_iterator_tag)
+	{
+		for (; n > 0 && first != last; --n)
+		{
+			++first;
+		}
+		return first;
+	}
+
+	template <typename RandomAccessIterator, typename Distance>
+	inline RandomAccessIterator __drop_begin(RandomAccessIterator first, RandomAccessIterator last, Distance n,
+		random_access_iterator_tag)
+	{
+		return first + my_STL::min(n, Distance(last - first));
+	}
+
+	//迭代器即底层迭代器
+	template <typename View>
+	class drop_view :public __view_base
+	{
+	public:
+		using iterator = typename View::iterator;
+		using difference_type = typename iterator_traits<iterator>::difference_type;
+
+	protected:
+		View base;
+		difference_type count;
+
+	public:
+		drop_view(const View &v, difference_type n) :base(v), count(n) {}
+
+		iterator begin() const
+		{
+			iterator first = base.begin();
+			return __drop_begin(first, base.end(), count, iterator_category(first));
+		}
+
+		iterator end() const
+		{
+			return base.end();
+		}
+	};
+
+	struct __drop_fn
+	{
+		ptrdiff_t count;
+		explicit __drop_fn(ptrdiff_t n) :count(n) {}
+
+		template <typename View>
+		drop_view<View> operator()(const View &v) const
+		{
+			return drop_view<View>(v, count);
+		}
+	};
+	//****************************************
+
+	//zip_view
+	//****************************************
+	//两者中较弱的类型，解引用得到pair<reference1, reference2>
+	template <typename Iterator1, typename Iterator2>
+	struct __zip_iterator
+	{
+		using iterator_category = typename __weaker_category<
+			typename iterator_traits<Iterator1>::iterator_category,
+			typename iterator_traits<Iterator2>::iterator_category>::type;
+		using value_type = std::pair<typename iterator_traits<Iterator1>::value_type,
+			typename iterator_traits<Iterator2>::value_type>;
+		using reference = std::pair<typename iterator_traits<Iterator1>::reference,
+			typename iterator_traits<Iterator2>::reference>;
+		using difference_type = typename iterator_traits<Iterator1>::difference_type;
+		using pointer = void;
+
+		Iterator1 first;
+		Iterator2 second;
+
+		__zip_iterator() :first(), second() {}
+		__zip_iterator(Iterator1 i1, Iterator2 i2) :first(i1), second(i2) {}
+
+		reference operator*() const
+		{
+			return reference(*first, *second);
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return reference(first[n], second[n]);
+		}
+
+		//较短的区间先结束
+		bool operator==(const __zip_iterator &it) const
+		{
+			return first == it.first || second == it.second;
+		}
+
+		bool operator!=(const __zip_iterator &it) const
+		{
+			return !(*this == it);
+		}
+
+		bool operator<(const __zip_iterator &it) const
+		{
+			return first < it.first;
+		}
+
+		bool operator>(const __zip_iterator &it) const
+		{
+			return it < *this;
+		}
+
+		bool operator<=(const __zip_iterator &it) const
+		{
+			return !(it < *this);
+		}
+
+		bool operator>=(const __zip_iterator &it) const
+		{
+			return !(*this < it);
+		}
+
+		__zip_iterator &operator++()
+		{
+			++first;
+			++second;
+			return *this;
+		}
+
+		__zip_iterator operator++(int)
+		{
+			__zip_iterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		__zip_iterator &operator--()
+		{
+			--first;
+			--second;
+			return *this;
+		}
+
+		__zip_iterator operator--(int)
+		{
+			__zip_iterator temp = *this;
+			--*this;
+			return temp;
+		}
+
+		__zip_iterator &operator+=(difference_type n)
+		{
+			first += n;
+			second += n;
+			return *this;
+		}
+
+		__zip_iterator &operator-=(difference_type n)
+		{
+			first -= n;
+			second -= n;
+			return *this;
+		}
+
+		__zip_iterator operator+(difference_type n) const
+		{
+			return __zip_iterator(first + n, second + n);
+		}
+
+		__zip_iterator operator-(difference_type n) const
+		{
+			return __zip_iterator(first - n, second - n);
+		}
+
+		difference_type operator-(const __zip_iterator &it) const
+		{
+			return first - it.first;
+		}
+	};
+
+	template <typename Iterator1, typename Iterator2>
+	inline __zip_iterator<Iterator1, Iterator2> __zip_end(Iterator1, Iterator1 last1, Iterator2, Iterator2 last2,
+		input_iterator_tag)
+	{
+		return __zip_iterator<Iterator1, Iterator2>(last1, last2);
+	}
+
+	//random access时两端都截到较短的长度，使end - begin正确
+	template <typename Iterator1, typename Iterator2>
+	inline __zip_iterator<Iterator1, Iterator2> __zip_end(Iterator1 first1, Iterator1 last1,
+		Iterator2 first2, Iterator2 last2, random_access_iterator_tag)
+	{
+		typename iterator_traits<Iterator1>::difference_type n = my_STL::min(last1 - first1,
+			typename iterator_traits<Iterator1>::difference_type(last2 - first2));
+		return __zip_iterator<Iterator1, Iterator2>(first1 + n, first2 + n);
+	}
+
+	template <typename View1, typename View2>
+	class zip_view :public __view_base
+	{
+	public:
+		using iterator = __zip_iterator<typename View1::iterator, typename View2::iterator>;
+
+	protected:
+		View1 base1;
+		View2 base2;
+
+	public:
+		zip_view(const View1 &v1, const View2 &v2) :base1(v1), base2(v2) {}
+
+		iterator begin() const
+		{
+			return iterator(base1.begin(), base2.begin());
+		}
+
+		iterator end() const
+		{
+			using category = typename iterator_traits<iterator>::iterator_category;
+			return __zip_end(base1.begin(), base1.end(), base2.begin(), base2.end(), category());
+		}
+	};
+
+	template <typename View2>
+	struct __zip_fn
+	{
+		View2 other;
+		explicit __zip_fn(const View2 &v) :other(v) {}
+
+		template <typename View1>
+		zip_view<View1, View2> operator()(const View1 &v) const
+		{
+			return zip_view<View1, View2>(v, other);
+		}
+	};
+	//****************************************
+
+	//chunk_view
+	//****************************************
+	//解引用得到长度为n的subrange（最后一块可能不足n）；非random access时为forward
+	template <typename Iterator, typename Category = typename iterator_traits<Iterator>::iterator_category>
+	struct __chunk_iterator
+	{
+		using iterator_category = forward_iterator_tag;
+		using value_type = subrange<Iterator>;
+		using reference = subrange<Iterator>;
+		using difference_type = typename iterator_traits<Iterator>::difference_type;
+		using pointer = void;
+
+		Iterator current;
+		Iterator next;                  //本块的尾端
+		Iterator last;
+		difference_type n;
+
+		__chunk_iterator() :current(), next(), last(), n(0) {}
+		__chunk_iterator(Iterator c, Iterator l, difference_type size) :current(c), next(c), last(l), n(size)
+		{
+			find_next();
+		}
+
+		void find_next()
+		{
+			next = current;
+			for (difference_type i = 0; i < n && next != last; ++i)
+			{
+				++next;
+			}
+		}
+
+		static __chunk_iterator make_begin(Iterator first, Iterator last, difference_type size)
+		{
+			return __chunk_iterator(first, last, size);
+		}
+
+		static __chunk_iterator make_end(Iterator, Iterator last, difference_type size)
+		{
+			return __chunk_iterator(last, last, size);
+		}
+
+		reference operator*() const
+		{
+			return reference(current, next);
+		}
+
+		bool operator==(const __chunk_iterator &it) const
+		{
+			return current == it.current;
+		}
+
+		bool operator!=(const __chunk_iterator &it) const
+		{
+			return !(*this == it);
+		}
+
+		__chunk_iterator &operator++()
+		{
+			current = next;
+			find_next();
+			return *this;
+		}
+
+		__chunk_iterator operator++(int)
+		{
+			__chunk_iterator temp = *this;
+			++*this;
+			return temp;
+		}
+	};
+
+	//random access时按块号定位
+	template <typename Iterator>
+	struct __chunk_iterator<Iterator, random_access_iterator_tag>
+	{
+		using iterator_category = random_access_iterator_tag;
+		using value_type = subrange<Iterator>;
+		using reference = subrange<Iterator>;
+		using difference_type = typename iterator_traits<Iterator>::difference_type;
+		using pointer = void;
+
+		Iterator first;
+		difference_type size;           //底层区间长度
+		difference_type n;
+		difference_type index;          //块号
+
+		__chunk_iterator() :first(), size(0), n(0), index(0) {}
+		__chunk_iterator(Iterator f, difference_type len, difference_type chunk, difference_type i)
+			:first(f), size(len), n(chunk), index(i) {}
+
+		static __chunk_iterator make_begin(Iterator first, Iterator last, difference_type chunk)
+		{
+			return __chunk_iterator(first, last - first, chunk, 0);
+		}
+
+		static __chunk_iterator make_end(Iterator first, Iterator last, difference_type chunk)
+		{
+			difference_type len = last - first;
+			return __chunk_iterator(first, len, chunk, (len + chunk - 1) / chunk);
+		}
+
+		reference operator*() const
+		{
+			difference_type lo = index * n;
+			return reference(first + lo, first + my_STL::min(lo + n, size));
+		}
+
+		reference operator[](difference_type k) const
+		{
+			return *(*this + k);
+		}
+
+		bool operator==(const __chunk_iterator &it) const
+		{
+			return index == it.index;
+		}
+
+		bool operator!=(const __chunk_iterator &it) const
+		{
+			return !(*this == it);
+		}
+
+		bool operator<(const __chunk_iterator &it) const
+		{
+			return index < it.index;
+		}
+
+		bool operator>(const __chunk_iterator &it) const
+		{
+			return it < *this;
+		}
+
+		bool operator<=(const __chunk_iterator &it) const
+		{
+			return !(it < *this);
+		}
+
+		bool operator>=(const __chunk_iterator &it) const
+		{
+			return !(*this < it);
+		}
+
+		__chunk_iterator &operator++()
+		{
+			++index;
+			return *this;
+		}
+
+		__chunk_iterator operator++(int)
+		{
+			__chunk_iterator temp = *this;
+			++index;
+			return temp;
+		}
+
+		__chunk_iterator &operator--()
+		{
+			--index;
+			return *this;
+		}
+
+		__chunk_iterator operator--(int)
+		{
+			__chunk_iterator temp = *this;
+			--index;
+			return temp;
+		}
+
+		__chunk_iterator &operator+=(difference_type k)
+		{
+			index += k;
+			return *this;
+		}
+
+		__chunk_iterator &operator-=(difference_type k)
+		{
+			index -= k;
+			return *this;
+		}
+
+		__chunk_iterator operator+(difference_type k) const
+		{
+			return __chunk_iterator(first, size, n, index + k);
+		}
+
+		__chunk_iterator operator-(difference_type k) const
+		{
+			return __chunk_iterator(first, size, n, index - k);
+		}
+
+		difference_type operator-(const __chunk_iterator &it) const
+		{
+			return index - it.index;
+		}
+	};
+
+	template <typename View>
+	class chunk_view :public __view_base
+	{
+	public:
+		using iterator = __chunk_iterator<typename View::iterator>;
+		using difference_type = typename iterator_traits<typename View::iterator>::difference_type;
+
+	protected:
+		View base;
+		difference_type n;
+
+	public:
+		chunk_view(const View &v, difference_type size) :base(v), n(size) {}
+
+		iterator begin() const
+		{
+			return iterator::make_begin(base.begin(), base.end(), n);
+		}
+
+		iterator end() const
+		{
+			return iterator::make_end(base.begin(), base.end(), n);
+		}
+	};
+
+	struct __chunk_fn
+	{
+		ptrdiff_t n;
+		explicit __chunk_fn(ptrdiff_t size) :n(size) {}
+
+		template <typename View>
+		chunk_view<View> operator()(const View &v) const
+		{
+			return chunk_view<View>(v, n);
+		}
+	};
+	//****************************************
+
+	//stride_view
+	//****************************************
+	//每隔step个取一个；非random access时为forward
+	template <typename Iterator, typename Category = typename iterator_traits<Iterator>::iterator_category>
+	struct __stride_iterator
+	{
+		using iterator_category = forward_iterator_tag;
+		using value_type = typename iterator_traits<Iterator>::value_type;
+		using difference_type = typename iterator_traits<Iterator>::difference_type;
+		using pointer = typename iterator_traits<Iterator>::pointer;
+		using reference = typename iterator_traits<Iterator>::reference;
+
+		Iterator current;
+		Iterator last;
+		difference_type step;
+
+		__stride_iterator() :current(), last(), step(0) {}
+		__stride_iterator(Iterator c, Iterator l, difference_type s) :current(c), last(l), step(s) {}
+
+		static __stride_iterator make_begin(Iterator first, Iterator last, difference_type s)
+		{
+			return __stride_iterator(first, last, s);
+		}
+
+		static __stride_iterator make_end(Iterator, Iterator last, difference_type s)
+		{
+			return __stride_iterator(last, last, s);
+		}
+
+		reference operator*() const
+		{
+			return *current;
+		}
+
+		bool operator==(const __stride_iterator &it) const
+		{
+			return current == it.current;
+		}
+
+		bool operator!=(const __stride_iterator &it) const
+		{
+			return !(*this == it);
+		}
+
+		__stride_iterator &operator++()
+		{
+			for (difference_type i = 0; i < step && current != last; ++i)
+			{
+				++current;
+			}
+			return *this;
+		}
+
+		__stride_iterator operator++(int)
+		{
+			__stride_iterator temp = *this;
+			++*this;
+			return temp;
+		}
+	};
+
+	//random access时按下标定位
+	template <typename Iterator>
+	struct __stride_iterator<Iterator, random_access_iterator_tag>
+	{
+		using iterator_category = random_access_iterator_tag;
+		using value_type = typename iterator_traits<Iterator>::value_type;
+		using difference_type = typename iterator_traits<Iterator>::difference_type;
+		using pointer = typename iterator_traits<Iterator>::pointer;
+		using reference = typename iterator_traits<Iterator>::reference;
+
+		Iterator first;
+		difference_type step;
+		difference_type index;          //第几个被选中的元素
+
+		__stride_iterator() :first(), step(0), index(0) {}
+		__stride_iterator(Iterator f, difference_type s, difference_type i) :first(f), step(s), index(i) {}
+
+		static __stride_iterator make_begin(Iterator first, Iterator, difference_type s)
+		{
+			return __stride_iterator(first, s, 0);
+		}
+
+		static __stride_iterator make_end(Iterator first, Iterator last, difference_type s)
+		{
+			return __stride_iterator(first, s, ((last - first) + s - 1) / s);
+		}
+
+		reference operator*() const
+		{
+			return first[index * step];
+		}
+
+		reference operator[](difference_type k) const
+		{
+			return first[(index + k) * step];
+		}
+
+		bool operator==(const __stride_iterator &it) const
+		{
+			return index == it.index;
+		}
+
+		bool operator!=(const __stride_iterator &it) const
+		{
+			return !(*this == it);
+		}
+
+		bool operator<(const __stride_iterator &it) const
+		{
+			return index < it.index;
+		}
+
+		bool operator>(const __stride_iterator &it) const
+		{
+			return it < *this;
+		}
+
+		bool operator<=(const __stride_iterator &it) const
+		{
+			return !(it < *this);
+		}
+
+		bool operator>=(const __stride_iterator &it) const
+		{
+			return !(*this < it);
+		}
+
+		__stride_iterator &operator++()
+		{
+			++index;
+			return *this;
+		}
+
+		__stride_iterator operator++(int)
+		{
+			__stride_iterator temp = *this;
+			++index;
+			return temp;
+		}
+
+		__stride_iterator &operator--()
+		{
+			--index;
+			return *this;
+		}
+
+		__stride_iterator operator--(int)
+		{
+			__stride_iterator temp = *this;
+			--index;
+			return temp;
+		}
+
+		__stride_iterator &operator+=(difference_type k)
+		{
+			index += k;
+			return *this;
+		}
+
+		__stride_iterator &operator-=(difference_type k)
+		{
+			index -= k;
+			return *this;
+		}
+
+		__stride_iterator operator+(difference_type k) const
+		{
+			return __stride_iterator(first, step, index + k);
+		}
+
+		__stride_iterator operator-(difference_type k) const
+		{
+			return __stride_iterator(first, step, index - k);
+		}
+
+		difference_type operator-(const __stride_iterator &it) const
+		{
+			return index - it.index;
+		}
+	};
+
+	template <typename View>
+	class stride_view :public __view_base
+	{
+	public:
+		using iterator = __stride_iterator<typename View::iterator>;
+		using difference_type = typename iterator_traits<typename View::iterator>::difference_type;
+
+	protected:
+		View base;
+		difference_type step;
+
+	public:
+		stride_view(const View &v, difference_type s) :base(v), step(s) {}
+
+		iterator begin() const
+		{
+			return iterator::make_begin(base.begin(), base.end(), step);
+		}
+
+		iterator end() const
+		{
+			return iterator::make_end(base.begin(), base.end(), step);
+		}
+	};
+
+	struct __stride_fn
+	{
+		ptrdiff_t step;
+		explicit __stride_fn(ptrdiff_t s) :step(s) {}
+
+		template <typename View>
+		stride_view<View> operator()(const View &v) const
+		{
+			return stride_view<View>(v, step);
+		}
+	};
+	//****************************************
+
+	//views：v | views::filter(pred) | views::take(n) ...
+	//****************************************
+	namespace views
+	{
+		template <typename Predicate>
+		inline __range_adaptor<__filter_fn<Predicate>> filter(Predicate pred)
+		{
+			return __range_adaptor<__filter_fn<Predicate>>(__filter_fn<Predicate>(pred));
+		}
+
+		template <typename Function>
+		inline __range_adaptor<__transform_fn<Function>> transform(Function f)
+		{
+			return __range_adaptor<__transform_fn<Function>>(__transform_fn<Function>(f));
+		}
+
+		inline __range_adaptor<__take_fn> take(ptrdiff_t n)
+		{
+			return __range_adaptor<__take_fn>(__take_fn(n));
+		}
+
+		inline __range_adaptor<__drop_fn> drop(ptrdiff_t n)
+		{
+			return __range_adaptor<__drop_fn>(__drop_fn(n));
+		}
+
+		template <typename Range>
+		inline __range_adaptor<__zip_fn<typename __all_result<Range>::type>> zip(Range &&r)
+		{
+			using view = typename __all_result<Range>::type;
+			return __range_adaptor<__zip_fn<view>>(__zip_fn<view>(__all(std::forward<Range>(r))));
+		}
+
+		//n须大于0
+		inline __range_adaptor<__chunk_fn> chunk(ptrdiff_t n)
+		{
+			return __range_adaptor<__chunk_fn>(__chunk_fn(n));
+		}
+
+		//step须大于0
+		inline __range_adaptor<__stride_fn> stride(ptrdiff_t step)
+		{
+			return __range_adaptor<__stride_fn>(__stride_fn(step));
+		}
+	}
+	//****************************************
+
+	//to：r | to<vector>()
+	//****************************************
+	template <template <typename...> class Container>
+	struct __to_adaptor {};
+
+	template <template <typename...> class Container>
+	inline __to_adaptor<Container> to()
+	{
+		return __to_adaptor<Container>();
+	}
+
+	//尺寸可知（随机访问或range自带size()）时才预先配置，否则按容器正常的几何增长追加
+	//不为了reserve先把view走一遍，那样整条管道要执行两次
+	template <typename Container>
+	inline void __range_reserve(Container &, size_t)
+	{
+	}
+
+	template <typename T, typename Alloc, typename Growth>
+	inline void __range_reserve(vector<T, Alloc, Growth> &c, size_t n)
+	{
+		c.reserve(c.size() + n);
+	}
+
+	template <typename InputIterator>
+	inline bool __iterator_known_size(InputIterator, InputIterator, size_t &, input_iterator_tag)
+	{
+		return false;
+	}
+
+	template <typename RandomAccessIterator>
+	inline bool __iterator_known_size(RandomAccessIterator first, RandomAccessIterator last, size_t &n,
+		random_access_iterator_tag)
+	{
+		n = static_cast<size_t>(last - first);
+		return true;
+	}
+
+	//尺寸可知时写入n并返回true；int版本优先匹配带size()的range
+	template <typename Range, typename Iterator>
+	inline auto __range_known_size(Range &r, Iterator, Iterator, size_t &n, int)
+		-> decltype(static_cast<size_t>(r.size()), true)
+	{
+		n = static_cast<size_t>(r.size());
+		return true;
+	}
+
+	template <typename Range, typename Iterator>
+	inline bool __range_known_size(Range &, Iterator first, Iterator last, size_t &n, long)
+	{
+		return __iterator_known_size(first, last, n, iterator_category(first));
+	}
+
+	template <typename Range, template <typename...> class Container>
+	Container<typename iterator_traits<typename __range_iterator<Range>::type>::value_type>
+		operator|(Range &&r, __to_adaptor<Container>)
+	{
+		using iterator = typename __range_iterator<Range>::type;
+		Container<typename iterator_traits<iterator>::value_type> result;
+		iterator first = r.begin();
+		iterator last = r.end();
+		size_t n;
+		if (__range_known_size(r, first, last, n, 0))
+		{
+			__range_reserve(result, n);
+		}
+		for (; first != last; ++first)
+		{
+			result.push_back(*first);
+		}
+		return result;
+	}
+	//****************************************
+}
+
+#endif // !__RANGES_H
@@ -0,0 +1,38 @@
+#ifndef __SEGMENTED_ITERATOR_H
+#define __SEGMENTED_ITERATOR_H
+
+#include "__Iterator.h"
+#include "__Type_traits.h"
+
+namespace my_STL
+{
+	//segmented iterator traits
+	//****************************************
+	//分段容器（deque、分块vector等）的迭代器可拆成"段迭代器 + 段内迭代器"
+	//特化本traits后，copy/fill/find/for_each在每段内用段内迭代器跑内层循环，不再逐元素检查段边界
+	//
+	//特化须提供：
+	//  is_segmented_iterator           __true_type
+	//  segment_iterator                遍历各段
+	//  local_iterator                  段内迭代器，通常为指针
+	//  segment(it) / local(it)         拆分迭代器
+	//  begin(seg) / end(seg)           段的局部区间
+	//  compose(seg, local)             由两部分合成迭代器
+	//尾后迭代器须拆成(最后一段, 段内尾后)，即对任何last，begin(segment(last))都有意义
+	template <typename Iterator>
+	struct __segmented_iterator_traits
+	{
+		using is_segmented_iterator = __false_type;
+	};
+
+	template <typename Iterator>
+	inline typename __segmented_iterator_traits<Iterator>::is_segmented_iterator
+	__is_segmented_iterator(const Iterator &)
+	{
+		using is_segmented = typename __segmented_iterator_traits<Iterator>::is_segmented_iterator;
+		return is_segmented();
+	}
+	//****************************************
+}
+
+#endif // !__SEGMENTED_ITERATOR_H
@@ -0,0 +1,499 @@
+#ifndef __SERIALIZE_H
+#define __SERIALIZE_H
+
+#include <cstdio>
+#include <stdint.h>
+#include <string.h>         //memcmp memcpy
+#include <type_traits>
+#ifndef _WIN32
+#include <sys/types.h>      //off_t
+#endif
+#include "__Vector.h"
+#include "__List.h"
+#include "__Mmap_vector.h"
+
+namespace my_STL
+{
+	//二进制格式
+	//****************************************
+	//文件头16字节：魔数"mySV"、版本、字节序标记（按本机字节序写入0x0102）、两个保留字
+	//其后为容器：16字节的容器头（元素个数u64、元素大小u32、保留u32），再接元素
+	//  trivially copyable的元素：元素大小为sizeof(T)，之后是连续的原始字节，一次fwrite/fread
+	//  嵌套容器：元素大小为0，之后逐个是子容器（各带容器头）
+	//顶层trivial载荷从文件第32字节开始，32字节对齐，可以直接映射后当作T数组使用（见serialized_view）
+	//只在写入时的字节序下读取：标记不符时读取失败，不做字节交换
+	//读取时容器头里的元素个数先与文件剩余字节核对，截断或伪造的个数使读取失败，不会照它配置内存
+	enum
+	{
+		__SERIAL_VERSION = 1,
+		__SERIAL_ENDIAN_TAG = 0x0102,
+		__SERIAL_LIST_BATCH = 4096,            //list的trivial元素攒够这么多字节写一次
+		__SERIAL_READ_BATCH = 1 << 16          //元素个数无法与文件大小核对时，每批至多配置这么多字节
+	};
+
+	struct __serial_file_header
+	{
+		char magic[4];
+		uint16_t version;
+		uint16_t endian;
+		uint32_t reserved[2];
+	};
+
+	struct __serial_container_header
+	{
+		uint64_t count;
+		uint32_t elem_size;
+		uint32_t reserved;
+	};
+
+	inline bool __serial_write(std::FILE *f, const void *p, size_t bytes)
+	{
+		return bytes == 0 || std::fwrite(p, 1, bytes, f) == bytes;
+	}
+
+	inline bool __serial_read(std::FILE *f, void *p, size_t bytes)
+	{
+		return bytes == 0 || std::fread(p, 1, bytes, f) == bytes;
+	}
+
+	inline bool __serial_write_header(std::FILE *f, uint64_t count, uint32_t elem_size)
+	{
+		__serial_container_header h = { count, elem_size, 0 };
+		return __serial_write(f, &h, sizeof(h));
+	}
+
+	inline int64_t __serial_tell(std::FILE *f)
+	{
+#ifdef _WIN32
+		return _ftelli64(f);
+#else
+		return ftello(f);
+#endif
+	}
+
+	inline bool __serial_seek(std::FILE *f, int64_t pos, int origin)
+	{
+#ifdef _WIN32
+		return _fseeki64(f, pos, origin) == 0;
+#else
+		return fseeko(f, static_cast<off_t>(pos), origin) == 0;
+#endif
+	}
+
+	//读取来源：可定位的文件记下末尾的偏移，容器头里的元素个数据此与剩余字节核对
+	//不可定位的来源（如管道）无法核对，由读取方分批配置
+	struct __serial_source
+	{
+		std::FILE *f;
+		int64_t end;
+		bool bounded;
+
+		explicit __serial_source(std::FILE *file) :f(file), end(0), bounded(false)
+		{
+			const int64_t pos = __serial_tell(f);
+			if (pos >= 0 && __serial_seek(f, 0, SEEK_END))
+			{
+				end = __serial_tell(f);
+				bounded = __serial_seek(f, pos, SEEK_SET) && end >= pos;
+			}
+		}
+
+		//当前位置之后至多还有多少字节，未知时为最大值
+		uint64_t remaining() const
+		{
+			if (!bounded)
+			{
+				return uint64_t(-1);
+			}
+			const int64_t pos = __serial_tell(f);
+			return pos < 0 || pos > end ? 0 : static_cast<uint64_t>(end - pos);
+		}
+	};
+
+	//读容器头，核对元素大小；个数超过max_count或文件剩余字节装不下时失败
+	//每个元素至少占elem_size字节，嵌套容器的元素至少占一个容器头
+	inline bool __serial_read_header(__serial_source &in, uint64_t &count, uint32_t elem_size, size_t max_count)
+	{
+		__serial_container_header h;
+		if (!__serial_read(in.f, &h, sizeof(h)) || h.elem_size != elem_size || h.count > max_count)
+		{
+			return false;
+		}
+		const uint64_t least = elem_size != 0 ? elem_size : sizeof(__serial_container_header);
+		if (h.count > in.remaining() / least)
+		{
+			return false;
+		}
+		count = h.count;
+		return true;
+	}
+
+	//来源无法核对个数时每批读入的元素数
+	template <typename T>
+	inline size_t __serial_read_batch()
+	{
+		return __SERIAL_READ_BATCH / sizeof(T) ? __SERIAL_READ_BATCH / sizeof(T) : 1;
+	}
+
+	inline void __serial_make_file_header(__serial_file_header &h)
+	{
+		memcpy(h.magic, "mySV", 4);
+		h.version = __SERIAL_VERSION;
+		h.endian = __SERIAL_ENDIAN_TAG;
+		h.reserved[0] = h.reserved[1] = 0;
+	}
+
+	inline bool __serial_check_file_header(const __serial_file_header &h)
+	{
+		return memcmp(h.magic, "mySV", 4) == 0 && h.version == __SERIAL_VERSION && h.endian == __SERIAL_ENDIAN_TAG;
+	}
+	//****************************************
+
+	//__serializer
+	//****************************************
+	//每种可序列化的类型一个特化：elem_size为容器头中记录的元素大小
+	//容器的特化以write_body/read_body读写一个对象（含容器头）
+	template <typename T>
+	struct __serializer
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "serialize requires trivially copyable T or a supported container");
+
+		using is_trivial = __true_type;
+
+		static uint32_t elem_size()
+		{
+			return sizeof(T);
+		}
+	};
+
+	//按元素型别分派：trivial的一次读写整段，否则逐个
+	template <typename T>
+	bool __serial_write_array(std::FILE *f, const T *p, size_t n, __true_type)
+	{
+		return __serial_write(f, p, n * sizeof(T));
+	}
+
+	template <typename T>
+	bool __serial_write_array(std::FILE *f, const T *p, size_t n, __false_type)
+	{
+		for (size_t i = 0; i != n; ++i)
+		{
+			if (!__serializer<T>::write_body(f, p[i]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template <typename T, typename Alloc, typename Growth>
+	struct __serializer<vector<T, Alloc, Growth>>
+	{
+		using is_trivial = __false_type;
+		using container = vector<T, Alloc, Growth>;
+		using elem_trivial = typename __serializer<T>::is_trivial;
+
+		static uint32_t elem_size()
+		{
+			return 0;
+		}
+
+		static bool write_body(std::FILE *f, const container &v)
+		{
+			return __serial_write_header(f, v.size(), __serializer<T>::elem_size())
+				&& __serial_write_array(f, v.begin(), v.size(), elem_trivial());
+		}
+
+		static bool read_body(__serial_source &in, container &v)
+		{
+			uint64_t n;
+			v.clear();
+			return __serial_read_header(in, n, __serializer<T>::elem_size(), v.max_size())
+				&& read_elements(in, v, static_cast<size_t>(n), elem_trivial());
+		}
+
+		//直接读进未初始化的容量；个数已与文件剩余字节核对过时一次配置，否则分批追加
+		static bool read_elements(__serial_source &in, container &v, size_t n, __true_type)
+		{
+			std::FILE *f = in.f;
+			const size_t batch = in.bounded ? n : __serial_read_batch<T>();
+			while (n != 0)
+			{
+				const size_t m = n < batch ? n : batch;
+				if (v.reserve_and_append(m, [f](T *p, size_t k) { return std::fread(p, sizeof(T), k, f); }) != m)
+				{
+					return false;
+				}
+				n -= m;
+			}
+			return true;
+		}
+
+		//嵌套元素读了才知道实际大小，按批resize，伪造的个数至多多配置一批
+		static bool read_elements(__serial_source &in, container &v, size_t n, __false_type)
+		{
+			const size_t batch = __serial_read_batch<T>();
+			for (size_t i = 0; i != n; )
+			{
+				const size_t m = n - i < batch ? n - i : batch;
+				v.resize(i + m);
+				for (const size_t last = i + m; i != last; ++i)
+				{
+					if (!__serializer<T>::read_body(in, v[i]))
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+	};
+
+	template <typename T, typename Alloc>
+	struct __serializer<list<T, Alloc>>
+	{
+		using is_trivial = __false_type;
+		using container = list<T, Alloc>;
+		using iterator = typename container::iterator;
+		using elem_trivial = typename __serializer<T>::is_trivial;
+
+		static uint32_t elem_size()
+		{
+			return 0;
+		}
+
+		static bool write_body(std::FILE *f, const container &l)
+		{
+			return __serial_write_header(f, l.size(), __serializer<T>::elem_size())
+				&& write_elements(f, l, elem_trivial());
+		}
+
+		//节点不连续：攒进缓冲区再整块写出
+		static bool write_elements(std::FILE *f, const container &l, __true_type)
+		{
+			enum
+			{
+				__BATCH = __SERIAL_LIST_BATCH / sizeof(T) ? __SERIAL_LIST_BATCH / sizeof(T) : 1
+			};
+			typename std::aligned_storage<sizeof(T) * __BATCH, alignof(T)>::type storage;
+			T *buf = reinterpret_cast<T *>(&storage);
+			size_t n = 0;
+			for (iterator it = l.begin(), last = l.end(); it != last; ++it)
+			{
+				memcpy(buf + n, &*it, sizeof(T));
+				if (++n == __BATCH)
+				{
+					if (!__serial_write(f, buf, n * sizeof(T)))
+					{
+						return false;
+					}
+					n = 0;
+				}
+			}
+			return __serial_write(f, buf, n * sizeof(T));
+		}
+
+		static bool write_elements(std::FILE *f, const container &l, __false_type)
+		{
+			for (iterator it = l.begin(), last = l.end(); it != last; ++it)
+			{
+				if (!__serializer<T>::write_body(f, *it))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		static bool read_body(__serial_source &in, container &l)
+		{
+			uint64_t n;
+			l.clear();
+			if (!__serial_read_header(in, n, __serializer<T>::elem_size(), l.max_size()))
+			{
+				return false;
+			}
+			for (; n != 0; --n)
+			{
+				l.push_back(T());
+				if (!read_element(in, l.back(), elem_trivial()))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		static bool read_element(__serial_source &in, T &x, __true_type)
+		{
+			return __serial_read(in.f, &x, sizeof(T));
+		}
+
+		static bool read_element(__serial_source &in, T &x, __false_type)
+		{
+			return __serializer<T>::read_body(in, x);
+		}
+	};
+	//****************************************
+
+	//serialize / deserialize
+	//****************************************
+	//写入文件头与容器c，成功返回true；f须以二进制方式打开
+	template <typename Container>
+	bool serialize(std::FILE *f, const Container &c)
+	{
+		__serial_file_header h;
+		__serial_make_file_header(h);
+		return __serial_write(f, &h, sizeof(h)) && __serializer<Container>::write_body(f, c);
+	}
+
+	template <typename Container>
+	bool serialize(const char *path, const Container &c)
+	{
+		std::FILE *f = std::fopen(path, "wb");
+		if (!f)
+		{
+			return false;
+		}
+		const bool ok = serialize(f, c);
+		return std::fclose(f) == 0 && ok;
+	}
+
+	//读出serialize写入的容器；失败（格式、版本、字节序或元素大小不符，文件过短）时c被清空
+	template <typename Container>
+	bool deserialize(std::FILE *f, Container &c)
+	{
+		__serial_file_header h;
+		__serial_source in(f);
+		if (__serial_read(f, &h, sizeof(h)) && __serial_check_file_header(h) && __serializer<Container>::read_body(in, c))
+		{
+			return true;
+		}
+		c.clear();
+		return false;
+	}
+
+	template <typename Container>
+	bool deserialize(const char *path, Container &c)
+	{
+		std::FILE *f = std::fopen(path, "rb");
+		if (!f)
+		{
+			c.clear();
+			return false;
+		}
+		const bool ok = deserialize(f, c);
+		std::fclose(f);
+		return ok;
+	}
+	//****************************************
+
+	//serialized_view
+	//****************************************
+	//把serialize写出的vector<T>或list<T>（T为trivially copyable）文件映射进来，只读、不复制
+	//元素直接位于映射区，视图存在期间文件不应被改写
+	template <typename T>
+	class serialized_view
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "serialized_view requires trivially copyable T");
+
+	public:
+		using value_type = T;
+		using const_iterator = const T*;
+		using iterator = const_iterator;
+		using const_reference = const T&;
+		using size_type = size_t;
+
+	protected:
+		enum
+		{
+			__PAYLOAD = sizeof(__serial_file_header) + sizeof(__serial_container_header)
+		};
+
+		mmap_vector<char> file;
+		const T *first;
+		size_type count;
+
+	public:
+		serialized_view() :first(nullptr), count(0) {}
+
+		explicit serialized_view(const char *path) :first(nullptr), count(0)
+		{
+			open(path);
+		}
+
+		//格式不符或文件长度与元素个数不符时返回false
+		bool open(const char *path)
+		{
+			close();
+			if (!file.open(path, true) || file.size() < size_type(__PAYLOAD))
+			{
+				close();
+				return false;
+			}
+			__serial_file_header h;
+			__serial_container_header c;
+			memcpy(&h, file.data(), sizeof(h));
+			memcpy(&c, file.data() + sizeof(h), sizeof(c));
+			if (!__serial_check_file_header(h) || c.elem_size != sizeof(T)
+				|| c.count > (file.size() - __PAYLOAD) / sizeof(T))
+			{
+				close();
+				return false;
+			}
+			first = reinterpret_cast<const T *>(file.data() + __PAYLOAD);
+			count = static_cast<size_type>(c.count);
+			return true;
+		}
+
+		void close()
+		{
+			file.close();
+			first = nullptr;
+			count = 0;
+		}
+
+		bool is_open() const
+		{
+			return first != nullptr || file.is_open();
+		}
+
+		const_iterator begin() const
+		{
+			return first;
+		}
+
+		const_iterator end() const
+		{
+			return first + count;
+		}
+
+		const T *data() const
+		{
+			return first;
+		}
+
+		size_type size() const
+		{
+			return count;
+		}
+
+		bool empty() const
+		{
+			return count == 0;
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return first[n];
+		}
+
+		void advise(typename mmap_vector<char>::access_hint h)
+		{
+			file.advise(h);
+		}
+	};
+	//****************************************
+}
+
+#endif // !__SERIALIZE_H
@@ -0,0 +1,504 @@
+#ifndef __SET_ALGORITHM_H
+#define __SET_ALGORITHM_H
+
+#include "__Config.h"
+#include "__Algorithm.h"
+#include "__Iterator.h"
+#include "__Sort.h"
+
+#ifdef __STL_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace my_STL
+{
+	//两个区间长度相差超过此倍数时，遍历较短的一方，在较长的一方中galloping
+	enum
+	{
+		__SET_GALLOP_RATIO = 16
+	};
+
+	template <typename Distance>
+	inline bool __set_is_skewed(Distance len1, Distance len2)
+	{
+		return len1 / __SET_GALLOP_RATIO > len2 || len2 / __SET_GALLOP_RATIO > len1;
+	}
+
+	//merge
+	//****************************************
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	OutputIterator __merge_linear(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first2, *first1))
+			{
+				*result = *first2;
+				++first2;
+			}
+			else
+			{
+				*result = *first1;
+				++first1;
+			}
+			++result;
+		}
+		return copy(first2, last2, copy(first1, last1, result));
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	inline OutputIterator __merge(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp,
+		input_iterator_tag, input_iterator_tag)
+	{
+		return __merge_linear(first1, last1, first2, last2, result, comp);
+	}
+
+	//交替galloping，每次整段搬移一侧小于对方当前元素的部分
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Compare>
+	OutputIterator __merge(RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+		RandomAccessIterator2 first2, RandomAccessIterator2 last2, OutputIterator result, Compare comp,
+		random_access_iterator_tag, random_access_iterator_tag)
+	{
+		if (!__set_is_skewed(last1 - first1, last2 - first2))
+		{
+			return __merge_linear(first1, last1, first2, last2, result, comp);
+		}
+		while (first1 != last1 && first2 != last2)
+		{
+			//区间2中小于*first1的元素
+			RandomAccessIterator2 k2 = __gallop_lower_bound(first2, last2, *first1, comp);
+			result = copy(first2, k2, result);
+			first2 = k2;
+			if (first2 == last2)
+			{
+				break;
+			}
+			//区间1中不大于*first2的元素，相等时区间1在前
+			RandomAccessIterator1 k1 = __gallop_upper_bound(first1, last1, *first2, comp);
+			result = copy(first1, k1, result);
+			first1 = k1;
+		}
+		return copy(first2, last2, copy(first1, last1, result));
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	inline OutputIterator merge(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		return __merge(first1, last1, first2, last2, result, comp, iterator_category(first1), iterator_category(first2));
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
+	inline OutputIterator merge(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		using value = typename iterator_traits<InputIterator1>::value_type;
+		return merge(first1, last1, first2, last2, result, __less<value>());
+	}
+	//****************************************
+
+	//set_union
+	//****************************************
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	OutputIterator __set_union_linear(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+			{
+				*result = *first1;
+				++first1;
+			}
+			else if (comp(*first2, *first1))
+			{
+				*result = *first2;
+				++first2;
+			}
+			else
+			{
+				*result = *first1;
+				++first1;
+				++first2;
+			}
+			++result;
+		}
+		return copy(first2, last2, copy(first1, last1, result));
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	inline OutputIterator __set_union(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp,
+		input_iterator_tag, input_iterator_tag)
+	{
+		return __set_union_linear(first1, last1, first2, last2, result, comp);
+	}
+
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Compare>
+	OutputIterator __set_union(RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+		RandomAccessIterator2 first2, RandomAccessIterator2 last2, OutputIterator result, Compare comp,
+		random_access_iterator_tag, random_access_iterator_tag)
+	{
+		if (!__set_is_skewed(last1 - first1, last2 - first2))
+		{
+			return __set_union_linear(first1, last1, first2, last2, result, comp);
+		}
+		while (first1 != last1 && first2 != last2)
+		{
+			RandomAccessIterator2 k2 = __gallop_lower_bound(first2, last2, *first1, comp);
+			result = copy(first2, k2, result);
+			first2 = k2;
+			if (first2 == last2)
+			{
+				break;
+			}
+			RandomAccessIterator1 k1 = __gallop_lower_bound(first1, last1, *first2, comp);
+			result = copy(first1, k1, result);
+			first1 = k1;
+			if (first1 == last1)
+			{
+				break;
+			}
+			//此时 *first1 >= *first2，不小于即相等，只输出一份
+			if (!comp(*first2, *first1))
+			{
+				*result = *first1;
+				++result;
+				++first1;
+				++first2;
+			}
+		}
+		return copy(first2, last2, copy(first1, last1, result));
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	inline OutputIterator set_union(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		return __set_union(first1, last1, first2, last2, result, comp,
+			iterator_category(first1), iterator_category(first2));
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
+	inline OutputIterator set_union(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		using value = typename iterator_traits<InputIterator1>::value_type;
+		return set_union(first1, last1, first2, last2, result, __less<value>());
+	}
+	//****************************************
+
+	//set_intersection
+	//****************************************
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	OutputIterator __set_intersection_linear(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+			{
+				++first1;
+			}
+			else if (comp(*first2, *first1))
+			{
+				++first2;
+			}
+			else
+			{
+				*result = *first1;
+				++result;
+				++first1;
+				++first2;
+			}
+		}
+		return result;
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	inline OutputIterator __set_intersection(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp,
+		input_iterator_tag, input_iterator_tag)
+	{
+		return __set_intersection_linear(first1, last1, first2, last2, result, comp);
+	}
+
+	//遍历较短的区间，在较长的区间中galloping查找
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Compare>
+	OutputIterator __set_intersection(RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+		RandomAccessIterator2 first2, RandomAccessIterator2 last2, OutputIterator result, Compare comp,
+		random_access_iterator_tag, random_access_iterator_tag)
+	{
+		if (!__set_is_skewed(last1 - first1, last2 - first2))
+		{
+			return __set_intersection_linear(first1, last1, first2, last2, result, comp);
+		}
+		if (last1 - first1 < last2 - first2)
+		{
+			for (; first1 != last1; ++first1)
+			{
+				first2 = __gallop_lower_bound(first2, last2, *first1, comp);
+				if (first2 == last2)
+				{
+					break;
+				}
+				if (!comp(*first1, *first2))
+				{
+					*result = *first1;
+					++result;
+					++first2;
+				}
+			}
+		}
+		else
+		{
+			for (; first2 != last2; ++first2)
+			{
+				first1 = __gallop_lower_bound(first1, last1, *first2, comp);
+				if (first1 == last1)
+				{
+					break;
+				}
+				if (!comp(*first2, *first1))
+				{
+					*result = *first1;
+					++result;
+					++first1;
+				}
+			}
+		}
+		return result;
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	inline OutputIterator set_intersection(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		return __set_intersection(first1, last1, first2, last2, result, comp,
+			iterator_category(first1), iterator_category(first2));
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
+	inline OutputIterator set_intersection(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		using value = typename iterator_traits<InputIterator1>::value_type;
+		return set_intersection(first1, last1, first2, last2, result, __less<value>());
+	}
+
+	//两个严格递增（无重复）的unsigned int区间求交，用于倒排表
+	//长度相近时每次比较4x4个元素(SSE2)，相差悬殊时改用galloping
+	inline unsigned int *set_intersection_unique(const unsigned int *first1, const unsigned int *last1,
+		const unsigned int *first2, const unsigned int *last2, unsigned int *result)
+	{
+		if (__set_is_skewed(last1 - first1, last2 - first2))
+		{
+			return __set_intersection(first1, last1, first2, last2, result, __less<unsigned int>(),
+				random_access_iterator_tag(), random_access_iterator_tag());
+		}
+#ifdef __STL_USE_SSE2
+		while (last1 - first1 >= 4 && last2 - first2 >= 4)
+		{
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first1));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first2));
+			//a与b的四个循环移位逐一比较，得到a中在b块里出现过的元素
+			__m128i m = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi32(a, b),
+					_mm_cmpeq_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 3, 2, 1)))),
+				_mm_or_si128(_mm_cmpeq_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(1, 0, 3, 2))),
+					_mm_cmpeq_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(2, 1, 0, 3)))));
+			int mask = _mm_movemask_ps(_mm_castsi128_ps(m));
+			for (int k = 0; mask != 0; ++k, mask >>= 1)
+			{
+				if (mask & 1)
+				{
+					*result++ = first1[k];
+				}
+			}
+			//块尾较小的一方整块前进，相等时两边都前进
+			unsigned int max1 = first1[3];
+			unsigned int max2 = first2[3];
+			if (max1 <= max2)
+			{
+				first1 += 4;
+			}
+			if (max2 <= max1)
+			{
+				first2 += 4;
+			}
+		}
+#endif
+		return __set_intersection_linear(first1, last1, first2, last2, result, __less<unsigned int>());
+	}
+	//****************************************
+
+	//set_difference
+	//****************************************
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	OutputIterator __set_difference_linear(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+			{
+				*result = *first1;
+				++result;
+				++first1;
+			}
+			else if (comp(*first2, *first1))
+			{
+				++first2;
+			}
+			else
+			{
+				++first1;
+				++first2;
+			}
+		}
+		return copy(first1, last1, result);
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	inline OutputIterator __set_difference(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp,
+		input_iterator_tag, input_iterator_tag)
+	{
+		return __set_difference_linear(first1, last1, first2, last2, result, comp);
+	}
+
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Compare>
+	OutputIterator __set_difference(RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+		RandomAccessIterator2 first2, RandomAccessIterator2 last2, OutputIterator result, Compare comp,
+		random_access_iterator_tag, random_access_iterator_tag)
+	{
+		if (!__set_is_skewed(last1 - first1, last2 - first2))
+		{
+			return __set_difference_linear(first1, last1, first2, last2, result, comp);
+		}
+		if (last1 - first1 < last2 - first2)
+		{
+			//区间1较短：逐个在区间2中查找
+			for (; first1 != last1; ++first1)
+			{
+				first2 = __gallop_lower_bound(first2, last2, *first1, comp);
+				if (first2 != last2 && !comp(*first1, *first2))
+				{
+					++first2;
+				}
+				else
+				{
+					*result = *first1;
+					++result;
+				}
+			}
+			return result;
+		}
+		//区间2较短：整段复制区间1中两个匹配点之间的元素
+		for (; first2 != last2 && first1 != last1; ++first2)
+		{
+			RandomAccessIterator1 k = __gallop_lower_bound(first1, last1, *first2, comp);
+			result = copy(first1, k, result);
+			first1 = k;
+			if (first1 != last1 && !comp(*first2, *first1))
+			{
+				++first1;
+			}
+		}
+		return copy(first1, last1, result);
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	inline OutputIterator set_difference(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		return __set_difference(first1, last1, first2, last2, result, comp,
+			iterator_category(first1), iterator_category(first2));
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
+	inline OutputIterator set_difference(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		using value = typename iterator_traits<InputIterator1>::value_type;
+		return set_difference(first1, last1, first2, last2, result, __less<value>());
+	}
+	//****************************************
+
+	//includes
+	//****************************************
+	template <typename InputIterator1, typename InputIterator2, typename Compare>
+	bool __includes_linear(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first2, *first1))
+			{
+				return false;
+			}
+			else if (comp(*first1, *first2))
+			{
+				++first1;
+			}
+			else
+			{
+				++first1;
+				++first2;
+			}
+		}
+		return first2 == last2;
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename Compare>
+	inline bool __includes(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, Compare comp, input_iterator_tag, input_iterator_tag)
+	{
+		return __includes_linear(first1, last1, first2, last2, comp);
+	}
+
+	template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Compare>
+	bool __includes(RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+		RandomAccessIterator2 first2, RandomAccessIterator2 last2, Compare comp,
+		random_access_iterator_tag, random_access_iterator_tag)
+	{
+		if (last2 - first2 > last1 - first1)
+		{
+			return false;
+		}
+		if (!__set_is_skewed(last1 - first1, last2 - first2))
+		{
+			return __includes_linear(first1, last1, first2, last2, comp);
+		}
+		for (; first2 != last2; ++first2)
+		{
+			first1 = __gallop_lower_bound(first1, last1, *first2, comp);
+			if (first1 == last1 || comp(*first2, *first1))
+			{
+				return false;
+			}
+			++first1;
+		}
+		return true;
+	}
+
+	template <typename InputIterator1, typename InputIterator2, typename Compare>
+	inline bool includes(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, Compare comp)
+	{
+		return __includes(first1, last1, first2, last2, comp, iterator_category(first1), iterator_category(first2));
+	}
+
+	template <typename InputIterator1, typename InputIterator2>
+	inline bool includes(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2)
+	{
+		using value = typename iterator_traits<InputIterator1>::value_type;
+		return includes(first1, last1, first2, last2, __less<value>());
+	}
+	//****************************************
+}
+
+#endif // !__SET_ALGORITHM_H
@@ -0,0 +1,664 @@
+#ifndef __SHARED_VECTOR_H
+#define __SHARED_VECTOR_H
+
+#include <atomic>
+#include <mutex>
+#include <new>              //placement new
+#include <thread>           //yield
+#include <type_traits>
+#include <utility>
+#include "__Allocator.h"
+#include "__Construct.h"
+#include "__Uninitialized.h"
+#include "__Iterator.h"
+#include "__Segmented_iterator.h"
+#include "__Vector.h"
+
+namespace my_STL
+{
+	enum
+	{
+		__SHARED_CHUNK = 64                 //每块的元素个数，版本之间以块为单位共享
+	};
+
+	//__shared_chunk / __shared_vector_rep
+	//****************************************
+	//块：带引用计数的定长存储，除最后一块外都是满的
+	template <typename T>
+	struct __shared_chunk
+	{
+		std::atomic<size_t> refs;
+		size_t count;
+		typename std::aligned_storage<sizeof(T) * __SHARED_CHUNK, alignof(T)>::type storage;
+
+		__shared_chunk() :refs(1), count(0) {}
+
+		T *data()
+		{
+			return reinterpret_cast<T *>(&storage);
+		}
+
+		const T *data() const
+		{
+			return reinterpret_cast<const T *>(&storage);
+		}
+	};
+
+	//版本：块指针的序列，发布后不再修改
+	//块、版本和块指针表都可能由读者线程释放，一律经由线程安全的new_allocator
+	template <typename T>
+	struct __shared_vector_rep
+	{
+		std::atomic<size_t> refs;
+		size_t size;
+		vector<__shared_chunk<T> *, new_allocator<__shared_chunk<T> *>> chunks;
+
+		__shared_vector_rep() :refs(1), size(0) {}
+	};
+
+	template <typename T>
+	inline __shared_chunk<T> *__shared_chunk_create()
+	{
+		__shared_chunk<T> *c = new_allocator<__shared_chunk<T>>::allocate();
+		return ::new(static_cast<void *>(c)) __shared_chunk<T>();
+	}
+
+	//复制一块，得到只属于调用者的副本
+	template <typename T>
+	__shared_chunk<T> *__shared_chunk_clone(const __shared_chunk<T> *c)
+	{
+		__shared_chunk<T> *p = __shared_chunk_create<T>();
+		try
+		{
+			uninitialized_copy(c->data(), c->data() + c->count, p->data());
+		}
+		catch (...)
+		{
+			new_allocator<__shared_chunk<T>>::deallocate(p);
+			throw;
+		}
+		p->count = c->count;
+		return p;
+	}
+
+	template <typename T>
+	inline void __shared_acquire(T *p)
+	{
+		if (p)
+		{
+			p->refs.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	//最后一个引用释放时才销毁
+	template <typename T>
+	void __shared_release(__shared_chunk<T> *c)
+	{
+		if (c->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			destroy(c->data(), c->data() + c->count);
+			c->~__shared_chunk<T>();
+			new_allocator<__shared_chunk<T>>::deallocate(c);
+		}
+	}
+
+	template <typename T>
+	void __shared_release(__shared_vector_rep<T> *r)
+	{
+		if (r && r->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			for (size_t i = 0; i != r->chunks.size(); ++i)
+			{
+				__shared_release(r->chunks[i]);
+			}
+			r->~__shared_vector_rep<T>();
+			new_allocator<__shared_vector_rep<T>>::deallocate(r);
+		}
+	}
+
+	template <typename T>
+	inline __shared_vector_rep<T> *__shared_rep_create()
+	{
+		__shared_vector_rep<T> *r = new_allocator<__shared_vector_rep<T>>::allocate();
+		return ::new(static_cast<void *>(r)) __shared_vector_rep<T>();
+	}
+	//****************************************
+
+	//__snapshot_iterator
+	//****************************************
+	template <typename T>
+	struct __snapshot_iterator
+	{
+		using iterator_category = random_access_iterator_tag;
+		using value_type = T;
+		using difference_type = ptrdiff_t;
+		using pointer = const T*;
+		using reference = const T&;
+
+		const __shared_vector_rep<T> *r;
+		size_t index;
+
+		__snapshot_iterator() :r(nullptr), index(0) {}
+		__snapshot_iterator(const __shared_vector_rep<T> *x, size_t i) :r(x), index(i) {}
+
+		reference operator*() const
+		{
+			return r->chunks[index / __SHARED_CHUNK]->data()[index % __SHARED_CHUNK];
+		}
+
+		pointer operator->() const
+		{
+			return &**this;
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return *(*this + n);
+		}
+
+		bool operator==(const __snapshot_iterator &it) const
+		{
+			return index == it.index;
+		}
+
+		bool operator!=(const __snapshot_iterator &it) const
+		{
+			return index != it.index;
+		}
+
+		bool operator<(const __snapshot_iterator &it) const
+		{
+			return index < it.index;
+		}
+
+		bool operator>(const __snapshot_iterator &it) const
+		{
+			return it.index < index;
+		}
+
+		bool operator<=(const __snapshot_iterator &it) const
+		{
+			return !(it.index < index);
+		}
+
+		bool operator>=(const __snapshot_iterator &it) const
+		{
+			return !(index < it.index);
+		}
+
+		__snapshot_iterator &operator++()
+		{
+			++index;
+			return *this;
+		}
+
+		__snapshot_iterator operator++(int)
+		{
+			__snapshot_iterator temp = *this;
+			++index;
+			return temp;
+		}
+
+		__snapshot_iterator &operator--()
+		{
+			--index;
+			return *this;
+		}
+
+		__snapshot_iterator operator--(int)
+		{
+			__snapshot_iterator temp = *this;
+			--index;
+			return temp;
+		}
+
+		__snapshot_iterator &operator+=(difference_type n)
+		{
+			index += n;
+			return *this;
+		}
+
+		__snapshot_iterator &operator-=(difference_type n)
+		{
+			index -= n;
+			return *this;
+		}
+
+		__snapshot_iterator operator+(difference_type n) const
+		{
+			return __snapshot_iterator(r, index + n);
+		}
+
+		__snapshot_iterator operator-(difference_type n) const
+		{
+			return __snapshot_iterator(r, index - n);
+		}
+
+		difference_type operator-(const __snapshot_iterator &it) const
+		{
+			return difference_type(index) - difference_type(it.index);
+		}
+	};
+
+	//段迭代器：第n块
+	template <typename T>
+	struct __snapshot_segment
+	{
+		const __shared_vector_rep<T> *r;
+		size_t n;
+
+		__snapshot_segment(const __shared_vector_rep<T> *x, size_t i) :r(x), n(i) {}
+
+		__snapshot_segment &operator++()
+		{
+			++n;
+			return *this;
+		}
+
+		bool operator==(const __snapshot_segment &s) const
+		{
+			return n == s.n;
+		}
+
+		bool operator!=(const __snapshot_segment &s) const
+		{
+			return n != s.n;
+		}
+	};
+
+	//以块为段：copy/find/for_each在块内按指针遍历
+	template <typename T>
+	struct __segmented_iterator_traits<__snapshot_iterator<T>>
+	{
+		using is_segmented_iterator = __true_type;
+		using segment_iterator = __snapshot_segment<T>;
+		using local_iterator = const T*;
+
+		//尾后迭代器恰在块边界时归入前一块
+		static segment_iterator segment(const __snapshot_iterator<T> &it)
+		{
+			size_t n = it.index / __SHARED_CHUNK;
+			if (n != 0 && n * __SHARED_CHUNK == it.index && it.index == it.r->size)
+			{
+				--n;
+			}
+			return segment_iterator(it.r, n);
+		}
+
+		static local_iterator local(const __snapshot_iterator<T> &it)
+		{
+			if (!it.r || it.r->size == 0)
+			{
+				return nullptr;
+			}
+			const segment_iterator s = segment(it);
+			return s.r->chunks[s.n]->data() + (it.index - s.n * __SHARED_CHUNK);
+		}
+
+		static local_iterator begin(const segment_iterator &s)
+		{
+			return s.r->chunks[s.n]->data();
+		}
+
+		static local_iterator end(const segment_iterator &s)
+		{
+			const __shared_chunk<T> *c = s.r->chunks[s.n];
+			return c->data() + c->count;
+		}
+
+		static __snapshot_iterator<T> compose(const segment_iterator &s, local_iterator p)
+		{
+			return __snapshot_iterator<T>(s.r, s.n * __SHARED_CHUNK + (p ? p - begin(s) : 0));
+		}
+	};
+	//****************************************
+
+	//vector_snapshot
+	//****************************************
+	//某一版本的只读视图；复制只增加引用计数，最后一个持有者释放时才回收
+	template <typename T>
+	class vector_snapshot
+	{
+	public:
+		using value_type = T;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using const_reference = const T&;
+		using const_iterator = __snapshot_iterator<T>;
+		using iterator = const_iterator;
+
+	protected:
+		using rep_type = __shared_vector_rep<T>;
+
+		rep_type *r;
+
+		template <typename U>
+		friend class shared_vector;
+
+		//接管一个已计数的引用
+		explicit vector_snapshot(rep_type *x) :r(x) {}
+
+	public:
+		vector_snapshot() :r(nullptr) {}
+
+		vector_snapshot(const vector_snapshot &s) :r(s.r)
+		{
+			__shared_acquire(r);
+		}
+
+		vector_snapshot(vector_snapshot &&s) :r(s.r)
+		{
+			s.r = nullptr;
+		}
+
+		vector_snapshot &operator=(vector_snapshot s)
+		{
+			my_STL::swap(r, s.r);
+			return *this;
+		}
+
+		~vector_snapshot()
+		{
+			__shared_release(r);
+		}
+
+		size_type size() const
+		{
+			return r ? r->size : 0;
+		}
+
+		bool empty() const
+		{
+			return size() == 0;
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return r->chunks[n / __SHARED_CHUNK]->data()[n % __SHARED_CHUNK];
+		}
+
+		const_reference front() const
+		{
+			return (*this)[0];
+		}
+
+		const_reference back() const
+		{
+			return (*this)[size() - 1];
+		}
+
+		const_iterator begin() const
+		{
+			return const_iterator(r, 0);
+		}
+
+		const_iterator end() const
+		{
+			return const_iterator(r, size());
+		}
+
+		//两个快照是否为同一版本
+		bool same_version(const vector_snapshot &s) const
+		{
+			return r == s.r;
+		}
+	};
+	//****************************************
+
+	//shared_vector
+	//****************************************
+	//读多写少的共享表：读者取得不可变快照，写者在草稿上修改后整体原子发布
+	//snapshot()是wait-free的：一次载入epoch、两次计数器增减加一次指针载入，不加锁、不重试
+	//写者之间由互斥量串行；草稿与旧版本共享未修改的块，只复制被修改的块
+	//读者计数按epoch的奇偶分成两个：发布时换上新版本，轮流推进epoch并等两个计数器各归零一次，
+	//随即放弃发布者对旧版本的引用；等待期间新来的读者计入另一个计数器，不会让发布者一直等下去
+	//最后一个引用可能在任一读者线程中释放，故版本与块都不经由alloc；元素自身若经由alloc配置内存则不受此保护
+	template <typename T>
+	class shared_vector
+	{
+	public:
+		using value_type = T;
+		using size_type = size_t;
+		using snapshot_type = vector_snapshot<T>;
+
+	protected:
+		using rep_type = __shared_vector_rep<T>;
+		using chunk_type = __shared_chunk<T>;
+
+		std::atomic<rep_type *> current;
+		std::atomic<size_t> epoch;
+		mutable std::atomic<size_t> readers[2];    //正在snapshot()中的读者数，按进入时epoch的奇偶分开
+		std::mutex write_lock;
+
+		void install(rep_type *r);
+
+	public:
+		//writer
+		//****************************************
+		//从某一版本出发的草稿，由一个线程独占
+		class writer
+		{
+			friend class shared_vector;
+
+		protected:
+			rep_type *base;        //出发的版本，用于publish_if_unchanged
+			rep_type *draft;
+
+			//块被其他版本共享时先复制
+			chunk_type *own(size_type n)
+			{
+				chunk_type *c = draft->chunks[n];
+				if (c->refs.load(std::memory_order_acquire) != 1)
+				{
+					chunk_type *p = __shared_chunk_clone(c);
+					draft->chunks[n] = p;
+					__shared_release(c);
+					c = p;
+				}
+				return c;
+			}
+
+		public:
+			explicit writer(const snapshot_type &s) :base(s.r), draft(__shared_rep_create<T>())
+			{
+				__shared_acquire(base);
+				if (base)
+				{
+					try
+					{
+						draft->chunks = base->chunks;
+					}
+					catch (...)
+					{
+						__shared_release(draft);
+						__shared_release(base);
+						throw;
+					}
+					for (size_type i = 0; i != draft->chunks.size(); ++i)
+					{
+						__shared_acquire(draft->chunks[i]);
+					}
+					draft->size = base->size;
+				}
+			}
+
+			writer(writer &&w) :base(w.base), draft(w.draft)
+			{
+				w.base = w.draft = nullptr;
+			}
+
+			writer(const writer &) = delete;
+			writer &operator=(const writer &) = delete;
+
+			~writer()
+			{
+				__shared_release(draft);
+				__shared_release(base);
+			}
+
+			size_type size() const
+			{
+				return draft->size;
+			}
+
+			bool empty() const
+			{
+				return draft->size == 0;
+			}
+
+			const T &operator[](size_type n) const
+			{
+				return draft->chunks[n / __SHARED_CHUNK]->data()[n % __SHARED_CHUNK];
+			}
+
+			void set(size_type n, const T &x)
+			{
+				own(n / __SHARED_CHUNK)->data()[n % __SHARED_CHUNK] = x;
+			}
+
+			void push_back(const T &x)
+			{
+				if (draft->size % __SHARED_CHUNK == 0)
+				{
+					chunk_type *c = __shared_chunk_create<T>();
+					try
+					{
+						construct(c->data(), x);
+						c->count = 1;
+						draft->chunks.push_back(c);
+					}
+					catch (...)
+					{
+						__shared_release(c);
+						throw;
+					}
+				}
+				else
+				{
+					chunk_type *c = own(draft->chunks.size() - 1);
+					construct(c->data() + c->count, x);
+					++c->count;
+				}
+				++draft->size;
+			}
+
+			void pop_back()
+			{
+				chunk_type *c = own(draft->chunks.size() - 1);
+				--c->count;
+				destroy(c->data() + c->count);
+				if (c->count == 0)
+				{
+					__shared_release(c);
+					draft->chunks.pop_back();
+				}
+				--draft->size;
+			}
+
+			void clear()
+			{
+				for (size_type i = 0; i != draft->chunks.size(); ++i)
+				{
+					__shared_release(draft->chunks[i]);
+				}
+				draft->chunks.clear();
+				draft->size = 0;
+			}
+
+			template <typename InputIterator>
+			void append(InputIterator first, InputIterator last)
+			{
+				for (; first != last; ++first)
+				{
+					push_back(*first);
+				}
+			}
+		};
+		//****************************************
+
+		shared_vector() :current(nullptr), epoch(0)
+		{
+			readers[0].store(0);
+			readers[1].store(0);
+		}
+
+		template <typename InputIterator>
+		shared_vector(InputIterator first, InputIterator last) :shared_vector()
+		{
+			writer w((snapshot_type()));
+			w.append(first, last);
+			publish(std::move(w));
+		}
+
+		shared_vector(const shared_vector &) = delete;
+		shared_vector &operator=(const shared_vector &) = delete;
+
+		~shared_vector()
+		{
+			__shared_release(current.load());
+		}
+
+		//当前版本的快照
+		snapshot_type snapshot() const
+		{
+			std::atomic<size_t> &n = readers[epoch.load() & 1];
+			n.fetch_add(1);
+			rep_type *r = current.load();
+			__shared_acquire(r);
+			n.fetch_sub(1);
+			return snapshot_type(r);
+		}
+
+		//以当前版本为起点的草稿
+		writer edit() const
+		{
+			return writer(snapshot());
+		}
+
+		//原子地以草稿替换当前版本，草稿随之失效
+		void publish(writer &&w)
+		{
+			std::lock_guard<std::mutex> lock(write_lock);
+			install(w.draft);
+			w.draft = nullptr;
+		}
+
+		//当前版本仍是草稿的出发版本时才发布，否则返回false、草稿保持不变
+		bool publish_if_unchanged(writer &&w)
+		{
+			std::lock_guard<std::mutex> lock(write_lock);
+			if (current.load() != w.base)
+			{
+				return false;
+			}
+			install(w.draft);
+			w.draft = nullptr;
+			return true;
+		}
+	};
+
+	/***********************************************************************/
+	//shared_vector
+	/***********************************************************************/
+	//调用者持有write_lock
+	//换上新版本后，两个计数器都须各归零一次：某个读者若在计数器归零之前已计入其中，发布者等它离开；
+	//若在之后才计入，它随后载入的已是新版本。只等一个计数器不够，读者可能按很久以前读到的epoch计入另一个
+	//每次等待之前先推进epoch，新来的读者计入另一个计数器，只有已读到旧epoch的读者需要等，等待有界
+	template <typename T>
+	void shared_vector<T>::install(rep_type *r)
+	{
+		rep_type *old = current.exchange(r);
+		for (int i = 0; i != 2; ++i)
+		{
+			const size_t e = epoch.fetch_add(1);
+			while (readers[e & 1].load() != 0)
+			{
+				std::this_thread::yield();
+			}
+		}
+		__shared_release(old);
+	}
+	//****************************************
+}
+
+#endif // !__SHARED_VECTOR_H
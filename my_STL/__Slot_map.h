@@ -0,0 +1,279 @@
+#ifndef __SLOT_MAP_H
+#define __SLOT_MAP_H
+
+#include <utility>
+#include "__Vector.h"
+
+namespace my_STL
+{
+	//slot_map_key
+	//****************************************
+	//句柄：槽位下标 + 代数；槽位每次释放代数加1，旧句柄随即失效
+	struct slot_map_key
+	{
+		unsigned index;
+		unsigned generation;
+
+		bool operator==(const slot_map_key &k) const
+		{
+			return index == k.index && generation == k.generation;
+		}
+
+		bool operator!=(const slot_map_key &k) const
+		{
+			return !(*this == k);
+		}
+	};
+	//****************************************
+
+	//slot_map
+	//****************************************
+	//元素紧密存放在values中，遍历即遍历vector；句柄经slots间接指向元素
+	//插入放到values尾部，删除时把最后一个元素搬来填补空位（swap-and-pop），两者都是O(1)
+	//释放的槽位串成free list以供复用；元素的地址与顺序会因删除而改变，句柄则不变
+	template <typename T>
+	class slot_map
+	{
+	public:
+		using value_type = T;
+		using key_type = slot_map_key;
+		using iterator = typename vector<T>::iterator;
+		using const_iterator = typename vector<T>::const_iterator;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using size_type = size_t;
+
+	protected:
+		enum
+		{
+			__NIL = ~0u                            //free list结尾
+		};
+
+		//使用中的槽位item为元素在values中的下标，空闲时为free list中下一个槽位
+		struct slot
+		{
+			unsigned item;
+			unsigned generation;
+		};
+
+		vector<T> values;
+		vector<unsigned> owners;                   //values[i]所属的槽位
+		vector<slot> slots;
+		unsigned free_head;
+
+		//句柄有效时返回其元素下标，否则返回__NIL
+		unsigned locate(key_type k) const
+		{
+			if (k.index >= slots.size())
+			{
+				return __NIL;
+			}
+			const slot &s = slots[k.index];
+			return s.generation == k.generation && s.item < values.size() && owners[s.item] == k.index ? s.item : __NIL;
+		}
+
+		void erase_at(unsigned i);
+
+	public:
+		slot_map() :free_head(__NIL) {}
+
+		iterator begin()
+		{
+			return values.begin();
+		}
+
+		const_iterator begin() const
+		{
+			return values.begin();
+		}
+
+		iterator end()
+		{
+			return values.end();
+		}
+
+		const_iterator end() const
+		{
+			return values.end();
+		}
+
+		//元素数组，下标与begin()一致
+		T *data()
+		{
+			return values.begin();
+		}
+
+		size_type size() const
+		{
+			return values.size();
+		}
+
+		bool empty() const
+		{
+			return values.empty();
+		}
+
+		void reserve(size_type n)
+		{
+			values.reserve(n);
+			owners.reserve(n);
+			slots.reserve(n);
+		}
+
+		key_type insert(const T &x);
+
+		//句柄失效时返回false
+		bool erase(key_type k)
+		{
+			const unsigned i = locate(k);
+			if (i == __NIL)
+			{
+				return false;
+			}
+			erase_at(i);
+			return true;
+		}
+
+		//删除一组句柄，返回实际删除的个数
+		template <typename InputIterator>
+		size_type erase(InputIterator first, InputIterator last)
+		{
+			size_type n = 0;
+			for (; first != last; ++first)
+			{
+				n += erase(*first);
+			}
+			return n;
+		}
+
+		//删除满足pred的元素，只扫一遍values，从后向前使得填补空位的元素都已检查过
+		template <typename Predicate>
+		size_type erase_if(Predicate pred)
+		{
+			const size_type old_size = values.size();
+			for (size_type i = old_size; i != 0; --i)
+			{
+				if (pred(values[i - 1]))
+				{
+					erase_at(static_cast<unsigned>(i - 1));
+				}
+			}
+			return old_size - values.size();
+		}
+
+		bool contains(key_type k) const
+		{
+			return locate(k) != __NIL;
+		}
+
+		//句柄失效时返回nullptr
+		T *find(key_type k)
+		{
+			const unsigned i = locate(k);
+			return i == __NIL ? nullptr : &values[i];
+		}
+
+		const T *find(key_type k) const
+		{
+			const unsigned i = locate(k);
+			return i == __NIL ? nullptr : &values[i];
+		}
+
+		//句柄须有效
+		reference operator[](key_type k)
+		{
+			return values[slots[k.index].item];
+		}
+
+		const_reference operator[](key_type k) const
+		{
+			return values[slots[k.index].item];
+		}
+
+		//由迭代器求句柄，用于遍历中删除
+		key_type key_of(const_iterator it) const
+		{
+			const unsigned s = owners[it - values.begin()];
+			key_type k = { s, slots[s].generation };
+			return k;
+		}
+
+		//清空元素，所有槽位进入free list，已发出的句柄全部失效
+		void clear();
+	};
+
+	/***********************************************************************/
+	//slot_map
+	/***********************************************************************/
+	template <typename T>
+	typename slot_map<T>::key_type slot_map<T>::insert(const T &x)
+	{
+		const bool fresh = free_head == __NIL;
+		if (fresh)
+		{
+			slot t = { __NIL, 0 };
+			slots.push_back(t);
+		}
+		const unsigned s = fresh ? static_cast<unsigned>(slots.size() - 1) : free_head;
+		try
+		{
+			values.push_back(x);
+			owners.push_back(s);
+		}
+		catch (...)
+		{
+			if (values.size() != owners.size())
+			{
+				values.pop_back();
+			}
+			if (fresh)                             //新槽位留作空闲
+			{
+				slots[s].item = free_head;
+				free_head = s;
+			}
+			throw;
+		}
+		if (!fresh)
+		{
+			free_head = slots[s].item;
+		}
+		slots[s].item = static_cast<unsigned>(values.size() - 1);
+		key_type k = { s, slots[s].generation };
+		return k;
+	}
+
+	template <typename T>
+	void slot_map<T>::erase_at(unsigned i)
+	{
+		const unsigned s = owners[i];
+		const unsigned last = static_cast<unsigned>(values.size() - 1);
+		if (i != last)
+		{
+			values[i] = std::move(values[last]);
+			owners[i] = owners[last];
+			slots[owners[i]].item = i;
+		}
+		values.pop_back();
+		owners.pop_back();
+		++slots[s].generation;
+		slots[s].item = free_head;
+		free_head = s;
+	}
+
+	template <typename T>
+	void slot_map<T>::clear()
+	{
+		for (size_type i = 0; i != owners.size(); ++i)
+		{
+			const unsigned s = owners[i];
+			++slots[s].generation;
+			slots[s].item = free_head;
+			free_head = s;
+		}
+		values.clear();
+		owners.clear();
+	}
+	//****************************************
+}
+
+#endif // !__SLOT_MAP_H
@@ -0,0 +1,571 @@
+#ifndef __SMALL_VECTOR_H
+#define __SMALL_VECTOR_H
+
+#include <initializer_list>
+#include <string.h>         //memcpy
+#include <type_traits>
+#include <utility>
+#include "__Allocator.h"
+#include "__Construct.h"
+#include "__Uninitialized.h"
+#include "__Vector.h"
+
+namespace my_STL
+{
+	//small_vector_base
+	//****************************************
+	//与N无关的部分：元素不超过内置缓冲区时不配置内存，溢出后搬到堆上
+	//函数以small_vector_base<T>&为参数即可接受任意N的small_vector
+	//POD元素的复制经由uninitialized_copy/destroy的型别分派，分别成为memmove与空操作
+	//搬走内置缓冲区时trivially copyable的元素直接memcpy，其余逐个移动构造
+	template <typename T>
+	class small_vector_base
+	{
+	public:
+		using value_type = T;
+		using pointer = value_type*;
+		using iterator = value_type*;
+		using const_iterator = const value_type*;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+
+	protected:
+		iterator start;            //使用空间头部
+		iterator finish;           //使用空间尾部
+		iterator cap;              //可用空间尾部
+		iterator buffer;           //内置缓冲区，由small_vector提供
+		size_type buffer_size;     //内置缓冲区可容纳的元素个数
+
+		using data_allocator = allocator<T>;
+
+	protected:
+		small_vector_base(iterator inline_buffer, size_type n)
+			:start(inline_buffer), finish(inline_buffer), cap(inline_buffer + n), buffer(inline_buffer), buffer_size(n) {}
+
+		//只能经由small_vector析构
+		~small_vector_base()
+		{
+			destroy(start, finish);
+			deallocate();
+		}
+
+		//释放堆空间；仍在内置缓冲区时什么也不做
+		void deallocate()
+		{
+			if (!is_small())
+			{
+				data_allocator::deallocate(start, cap - start);
+			}
+		}
+
+		//容量扩充到至少required，元素搬到新配置的堆空间
+		void grow(size_type required);
+
+		//接管rhs的元素，rhs变为空
+		void steal(small_vector_base &rhs);
+
+		//把[first, last)搬到未初始化的result处，源元素之后由调用者析构
+		static iterator relocate(iterator first, iterator last, iterator result, std::true_type)
+		{
+			memcpy(result, first, sizeof(T) * (last - first));
+			return result + (last - first);
+		}
+
+		static iterator relocate(iterator first, iterator last, iterator result, std::false_type)
+		{
+			iterator cur = result;
+			try
+			{
+				for (; first != last; ++first, ++cur)
+				{
+					construct(cur, std::move(*first));
+				}
+			}
+			catch (...)
+			{
+				destroy(result, cur);
+				throw;
+			}
+			return cur;
+		}
+
+		template <typename InputIterator>
+		void range_append(InputIterator first, InputIterator last, input_iterator_tag)
+		{
+			for (; first != last; ++first)
+			{
+				push_back(*first);
+			}
+		}
+
+		template <typename ForwardIterator>
+		void range_append(ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+		{
+			reserve(size() + distance(first, last));
+			finish = uninitialized_copy(first, last, finish);
+		}
+
+	public:
+		small_vector_base &operator=(const small_vector_base &rhs);
+		small_vector_base &operator=(small_vector_base &&rhs);
+
+	public:
+		reference operator[](size_type n)
+		{
+			return start[n];
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return start[n];
+		}
+
+		bool operator==(const small_vector_base &rhs) const;
+
+		bool operator!=(const small_vector_base &rhs) const
+		{
+			return !(*this == rhs);
+		}
+
+	public:
+		iterator begin()
+		{
+			return start;
+		}
+
+		iterator end()
+		{
+			return finish;
+		}
+
+		const_iterator begin() const
+		{
+			return start;
+		}
+
+		const_iterator end() const
+		{
+			return finish;
+		}
+
+		size_type size() const
+		{
+			return size_type(finish - start);
+		}
+
+		size_type capacity() const
+		{
+			return size_type(cap - start);
+		}
+
+		bool empty() const
+		{
+			return start == finish;
+		}
+
+		//元素是否仍在内置缓冲区
+		bool is_small() const
+		{
+			return start == buffer;
+		}
+
+		reference front()
+		{
+			return *start;
+		}
+
+		reference back()
+		{
+			return *(finish - 1);
+		}
+
+		void push_back(const T &x)
+		{
+			if (finish == cap)
+			{
+				T x_copy = x;              //x可能就在本容器中
+				grow(size() + 1);
+				construct(finish, x_copy);
+			}
+			else
+			{
+				construct(finish, x);
+			}
+			++finish;
+		}
+
+		void pop_back()
+		{
+			--finish;
+			destroy(finish);
+		}
+
+		iterator erase(iterator first, iterator last)
+		{
+			iterator i = copy(last, finish, first);
+			destroy(i, finish);
+			finish = i;
+			return first;
+		}
+
+		iterator erase(iterator position)
+		{
+			return erase(position, position + 1);
+		}
+
+		void resize(size_type new_size, const T &x)
+		{
+			if (new_size < size())
+			{
+				erase(start + new_size, finish);
+			}
+			else
+			{
+				insert(finish, new_size - size(), x);
+			}
+		}
+
+		void resize(size_type new_size)
+		{
+			resize(new_size, T());
+		}
+
+		void reserve(size_type n)
+		{
+			if (capacity() < n)
+			{
+				grow(n);
+			}
+		}
+
+		//装得下时搬回内置缓冲区
+		void shrink_to_fit();
+
+		void clear()
+		{
+			destroy(start, finish);
+			finish = start;
+		}
+
+		void insert(iterator position, size_type n, const T &x);
+
+		iterator insert(iterator position, const T &x)
+		{
+			const size_type offset = position - start;
+			insert(position, 1, x);
+			return start + offset;
+		}
+
+		template <typename InputIterator>
+		void append(InputIterator first, InputIterator last)
+		{
+			range_append(first, last, iterator_category(first));
+		}
+
+		void swap(small_vector_base &rhs);
+	};
+
+	template <typename T>
+	void small_vector_base<T>::grow(size_type required)
+	{
+		const size_type len = vector_growth_double::next_capacity(capacity(), required, sizeof(T));
+		iterator new_start = data_allocator::allocate(len);
+		iterator new_finish = new_start;
+		try
+		{
+			new_finish = uninitialized_copy(start, finish, new_start);
+		}
+		catch (...)
+		{
+			data_allocator::deallocate(new_start, len);
+			throw;
+		}
+		destroy(start, finish);
+		deallocate();
+		start = new_start;
+		finish = new_finish;
+		cap = new_start + len;
+	}
+
+	template <typename T>
+	void small_vector_base<T>::steal(small_vector_base &rhs)
+	{
+		if (rhs.is_small())
+		{
+			//内置缓冲区里的元素只能逐个搬
+			clear();
+			reserve(rhs.size());
+			finish = relocate(rhs.start, rhs.finish, start, typename std::is_trivially_copyable<T>::type());
+			rhs.clear();
+		}
+		else
+		{
+			//堆空间直接接管，rhs回到内置缓冲区
+			destroy(start, finish);
+			deallocate();
+			start = rhs.start;
+			finish = rhs.finish;
+			cap = rhs.cap;
+			rhs.start = rhs.finish = rhs.buffer;
+			rhs.cap = rhs.buffer + rhs.buffer_size;
+		}
+	}
+
+	template <typename T>
+	small_vector_base<T> &small_vector_base<T>::operator=(const small_vector_base &rhs)
+	{
+		if (this != &rhs)
+		{
+			const size_type n = rhs.size();
+			if (n <= size())
+			{
+				iterator i = copy(rhs.start, rhs.finish, start);
+				destroy(i, finish);
+			}
+			else if (n <= capacity())
+			{
+				copy(rhs.start, rhs.start + size(), start);
+				uninitialized_copy(rhs.start + size(), rhs.finish, finish);
+			}
+			else
+			{
+				clear();
+				grow(n);
+				uninitialized_copy(rhs.start, rhs.finish, start);
+			}
+			finish = start + n;
+		}
+		return *this;
+	}
+
+	template <typename T>
+	small_vector_base<T> &small_vector_base<T>::operator=(small_vector_base &&rhs)
+	{
+		if (this != &rhs)
+		{
+			steal(rhs);
+		}
+		return *this;
+	}
+
+	template <typename T>
+	bool small_vector_base<T>::operator==(const small_vector_base &rhs) const
+	{
+		if (size() != rhs.size())
+		{
+			return false;
+		}
+		for (const_iterator p = start, q = rhs.start; p != finish; ++p, ++q)
+		{
+			if (!(*p == *q))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template <typename T>
+	void small_vector_base<T>::shrink_to_fit()
+	{
+		if (is_small() || finish == cap)
+		{
+			return;
+		}
+		const size_type n = size();
+		const bool to_buffer = n <= buffer_size;
+		iterator new_start = to_buffer ? buffer : data_allocator::allocate(n);
+		try
+		{
+			uninitialized_copy(start, finish, new_start);
+		}
+		catch (...)
+		{
+			if (!to_buffer)
+			{
+				data_allocator::deallocate(new_start, n);
+			}
+			throw;
+		}
+		destroy(start, finish);
+		deallocate();
+		start = new_start;
+		finish = new_start + n;
+		cap = to_buffer ? buffer + buffer_size : finish;
+	}
+
+	template <typename T>
+	void small_vector_base<T>::insert(iterator position, size_type n, const T &x)
+	{
+		if (n == 0)
+		{
+			return;
+		}
+		T x_copy = x;
+		if (size_type(cap - finish) < n)
+		{
+			const size_type offset = position - start;
+			grow(size() + n);
+			position = start + offset;
+		}
+		const size_type elems_after = finish - position;
+		iterator old_finish = finish;
+		if (elems_after > n)
+		{
+			uninitialized_copy(finish - n, finish, finish);
+			finish += n;
+			copy_backward(position, old_finish - n, old_finish);
+			fill(position, position + n, x_copy);
+		}
+		else
+		{
+			uninitialized_fill_n(finish, n - elems_after, x_copy);
+			finish += n - elems_after;
+			uninitialized_copy(position, old_finish, finish);
+			finish += elems_after;
+			fill(position, old_finish, x_copy);
+		}
+	}
+	template <typename T>
+	void small_vector_base<T>::swap(small_vector_base &rhs)
+	{
+		if (this == &rhs)
+		{
+			return;
+		}
+		if (!is_small() && !rhs.is_small())
+		{
+			my_STL::swap(start, rhs.start);
+			my_STL::swap(finish, rhs.finish);
+			my_STL::swap(cap, rhs.cap);
+			return;
+		}
+		//至少一方在内置缓冲区：交换公共部分，再把较长一方多出的元素搬过去
+		small_vector_base &shorter = size() < rhs.size() ? *this : rhs;
+		small_vector_base &longer = size() < rhs.size() ? rhs : *this;
+		const size_type common = shorter.size();
+		shorter.reserve(longer.size());
+		for (size_type i = 0; i != common; ++i)
+		{
+			my_STL::swap(shorter.start[i], longer.start[i]);
+		}
+		shorter.append(longer.start + common, longer.finish);
+		longer.erase(longer.start + common, longer.finish);
+	}
+
+	//尺寸提示
+	template <typename T, typename Size>
+	inline void __container_reserve(small_vector_base<T> &v, Size n)
+	{
+		const size_t required = v.size() + static_cast<size_t>(n);
+		if (v.capacity() < required)
+		{
+			v.reserve(vector_growth_double::next_capacity(v.capacity(), required, sizeof(T)));
+		}
+	}
+	//****************************************
+
+	//small_vector
+	//****************************************
+	//前N个元素存放在对象内部
+	template <typename T, size_t N>
+	class small_vector :public small_vector_base<T>
+	{
+		static_assert(N > 0, "small_vector requires N > 0");
+
+	protected:
+		using base = small_vector_base<T>;
+
+		alignas(T) unsigned char storage[N * sizeof(T)];
+
+		T *inline_buffer()
+		{
+			return reinterpret_cast<T *>(storage);
+		}
+
+	public:
+		using size_type = typename base::size_type;
+
+		small_vector() :base(inline_buffer(), N) {}
+
+		small_vector(size_type n, const T &value) :base(inline_buffer(), N)
+		{
+			this->insert(this->end(), n, value);
+		}
+
+		small_vector(int n, const T &value) :base(inline_buffer(), N)
+		{
+			this->insert(this->end(), size_type(n), value);
+		}
+
+		small_vector(long n, const T &value) :base(inline_buffer(), N)
+		{
+			this->insert(this->end(), size_type(n), value);
+		}
+
+		explicit small_vector(size_type n) :base(inline_buffer(), N)
+		{
+			this->insert(this->end(), n, T());
+		}
+
+		small_vector(std::initializer_list<T> il) :base(inline_buffer(), N)
+		{
+			this->append(il.begin(), il.end());
+		}
+
+		small_vector(const small_vector &v) :base(inline_buffer(), N)
+		{
+			this->append(v.begin(), v.end());
+		}
+
+		small_vector(const base &v) :base(inline_buffer(), N)
+		{
+			this->append(v.begin(), v.end());
+		}
+
+		small_vector(small_vector &&v) :base(inline_buffer(), N)
+		{
+			this->steal(v);
+		}
+
+		small_vector(base &&v) :base(inline_buffer(), N)
+		{
+			this->steal(v);
+		}
+
+		small_vector &operator=(const small_vector &rhs)
+		{
+			base::operator=(rhs);
+			return *this;
+		}
+
+		small_vector &operator=(const base &rhs)
+		{
+			base::operator=(rhs);
+			return *this;
+		}
+
+		small_vector &operator=(small_vector &&rhs)
+		{
+			base::operator=(static_cast<base &&>(rhs));
+			return *this;
+		}
+
+		small_vector &operator=(base &&rhs)
+		{
+			base::operator=(static_cast<base &&>(rhs));
+			return *this;
+		}
+	};
+
+	template <typename T, size_t N, typename Size>
+	inline void __container_reserve(small_vector<T, N> &v, Size n)
+	{
+		__container_reserve(static_cast<small_vector_base<T> &>(v), n);
+	}
+	//****************************************
+}
+
+#endif // !__SMALL_VECTOR_H
@@ -0,0 +1,543 @@
+#ifndef __SOA_VECTOR_H
+#define __SOA_VECTOR_H
+
+#include <tuple>
+#include <type_traits>
+#include <utility>          //index_sequence
+#include "__Alloc.h"
+#include "__Construct.h"
+#include "__Uninitialized.h"
+#include "__Iterator.h"
+#include "__Ranges.h"       //subrange
+#include "__Vector.h"       //增长策略
+
+namespace my_STL
+{
+	enum
+	{
+		__SOA_COLUMN_ALIGN = 16             //每一列的起始地址按16字节对齐，便于SIMD载入
+	};
+
+	//__soa_iterator
+	//****************************************
+	//按行遍历soa_vector，解引用得到tuple<T&...>，各分量指向各列中同一行的元素
+	//Ts带const时为const_iterator
+	template <typename... Ts>
+	struct __soa_iterator
+	{
+		using iterator_category = random_access_iterator_tag;
+		using value_type = std::tuple<typename std::remove_const<Ts>::type...>;
+		using reference = std::tuple<Ts&...>;
+		using difference_type = ptrdiff_t;
+		using pointer = void;
+		using columns_type = std::tuple<Ts*...>;
+
+		columns_type columns;
+		difference_type index;
+
+		__soa_iterator() :columns(), index(0) {}
+		__soa_iterator(const columns_type &c, difference_type i) :columns(c), index(i) {}
+
+		//iterator转换为const_iterator
+		template <typename... Us>
+		__soa_iterator(const __soa_iterator<Us...> &it) :columns(it.columns), index(it.index) {}
+
+		reference operator*() const
+		{
+			return row(index, std::index_sequence_for<Ts...>());
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return row(index + n, std::index_sequence_for<Ts...>());
+		}
+
+		template <size_t... I>
+		reference row(difference_type i, std::index_sequence<I...>) const
+		{
+			return reference(std::get<I>(columns)[i]...);
+		}
+
+		bool operator==(const __soa_iterator &it) const
+		{
+			return index == it.index;
+		}
+
+		bool operator!=(const __soa_iterator &it) const
+		{
+			return index != it.index;
+		}
+
+		bool operator<(const __soa_iterator &it) const
+		{
+			return index < it.index;
+		}
+
+		bool operator>(const __soa_iterator &it) const
+		{
+			return it.index < index;
+		}
+
+		bool operator<=(const __soa_iterator &it) const
+		{
+			return !(it.index < index);
+		}
+
+		bool operator>=(const __soa_iterator &it) const
+		{
+			return !(index < it.index);
+		}
+
+		__soa_iterator &operator++()
+		{
+			++index;
+			return *this;
+		}
+
+		__soa_iterator operator++(int)
+		{
+			__soa_iterator temp = *this;
+			++index;
+			return temp;
+		}
+
+		__soa_iterator &operator--()
+		{
+			--index;
+			return *this;
+		}
+
+		__soa_iterator operator--(int)
+		{
+			__soa_iterator temp = *this;
+			--index;
+			return temp;
+		}
+
+		__soa_iterator &operator+=(difference_type n)
+		{
+			index += n;
+			return *this;
+		}
+
+		__soa_iterator &operator-=(difference_type n)
+		{
+			index -= n;
+			return *this;
+		}
+
+		__soa_iterator operator+(difference_type n) const
+		{
+			return __soa_iterator(columns, index + n);
+		}
+
+		__soa_iterator operator-(difference_type n) const
+		{
+			return __soa_iterator(columns, index - n);
+		}
+
+		difference_type operator-(const __soa_iterator &it) const
+		{
+			return index - it.index;
+		}
+	};
+	//****************************************
+
+	//soa_vector
+	//****************************************
+	//structure of arrays：每个字段一列连续数组，所有列放在同一次配置的内存块中
+	//只扫描一两个字段的循环只载入用到的列，cache line不再被其余字段占据
+	//column<I>()得到第I列的连续区间，push_back/operator[]/迭代器按行操作
+	template <typename... Ts>
+	class soa_vector
+	{
+		static_assert(sizeof...(Ts) > 0, "soa_vector requires at least one column");
+
+	public:
+		using value_type = std::tuple<Ts...>;
+		using reference = std::tuple<Ts&...>;
+		using const_reference = std::tuple<const Ts&...>;
+		using iterator = __soa_iterator<Ts...>;
+		using const_iterator = __soa_iterator<const Ts...>;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+
+		template <size_t I>
+		using column_type = typename std::tuple_element<I, value_type>::type;
+
+		static const size_t column_count = sizeof...(Ts);
+
+	protected:
+		using columns_type = std::tuple<Ts*...>;
+		using column_indices = std::index_sequence_for<Ts...>;
+
+		columns_type columns;      //各列起始位置
+		size_type count;           //行数
+		size_type cap;             //每列可容纳的行数
+		char *block;               //配置得到的内存块，未对齐
+		size_type block_bytes;
+
+		//capacity为n时各列在块内的偏移，返回所需字节数（不含对齐余量）
+		static size_type layout(size_type n, size_type (&offsets)[sizeof...(Ts)])
+		{
+			const size_type sizes[] = { sizeof(Ts)... };
+			size_type bytes = 0;
+			for (size_t i = 0; i < sizeof...(Ts); ++i)
+			{
+				offsets[i] = bytes;
+				bytes += (sizes[i] * n + __SOA_COLUMN_ALIGN - 1) & ~size_type(__SOA_COLUMN_ALIGN - 1);
+			}
+			return bytes;
+		}
+
+		template <size_t... I>
+		static columns_type make_columns(char *base, const size_type (&offsets)[sizeof...(Ts)],
+			std::index_sequence<I...>)
+		{
+			return columns_type(reinterpret_cast<Ts *>(base + offsets[I])...);
+		}
+
+		//前done列的[first, last)行
+		template <size_t... I>
+		static void destroy_rows(const columns_type &c, size_type first, size_type last, size_t done,
+			std::index_sequence<I...>)
+		{
+			int swallow[] = { (I < done ? destroy(std::get<I>(c) + first, std::get<I>(c) + last) : void(), 0)... };
+			(void)swallow;
+		}
+
+		//各列依次整体复制，任一列抛出异常时析构已复制的列
+		template <size_t... I>
+		static void copy_rows(const columns_type &from, size_type n, const columns_type &to,
+			std::index_sequence<I...>)
+		{
+			size_t done = 0;
+			try
+			{
+				int swallow[] = { (uninitialized_copy(std::get<I>(from), std::get<I>(from) + n, std::get<I>(to)),
+					++done, 0)... };
+				(void)swallow;
+			}
+			catch (...)
+			{
+				destroy_rows(to, 0, n, done, column_indices());
+				throw;
+			}
+		}
+
+		template <typename Row, size_t... I>
+		void construct_row(size_type i, const Row &row, std::index_sequence<I...>)
+		{
+			size_t done = 0;
+			try
+			{
+				int swallow[] = { (construct(std::get<I>(columns) + i, std::get<I>(row)), ++done, 0)... };
+				(void)swallow;
+			}
+			catch (...)
+			{
+				destroy_rows(columns, i, i + 1, done, column_indices());
+				throw;
+			}
+		}
+
+		template <size_t... I>
+		reference make_row(size_type i, std::index_sequence<I...>)
+		{
+			return reference(std::get<I>(columns)[i]...);
+		}
+
+		template <size_t... I>
+		const_reference make_row(size_type i, std::index_sequence<I...>) const
+		{
+			return const_reference(std::get<I>(columns)[i]...);
+		}
+
+		//配置容量为n的新块，把所有列一次搬过去
+		void relocate(size_type n);
+		void deallocate();
+
+	public:
+		soa_vector() :columns(), count(0), cap(0), block(nullptr), block_bytes(0) {}
+
+		soa_vector(const soa_vector &v) :columns(), count(0), cap(0), block(nullptr), block_bytes(0)
+		{
+			if (v.count != 0)
+			{
+				relocate(v.count);
+				try
+				{
+					copy_rows(v.columns, v.count, columns, column_indices());
+				}
+				catch (...)
+				{
+					deallocate();
+					throw;
+				}
+				count = v.count;
+			}
+		}
+
+		soa_vector(soa_vector &&v) :columns(v.columns), count(v.count), cap(v.cap), block(v.block),
+			block_bytes(v.block_bytes)
+		{
+			v.columns = columns_type();
+			v.count = v.cap = 0;
+			v.block = nullptr;
+			v.block_bytes = 0;
+		}
+
+		soa_vector &operator=(const soa_vector &v)
+		{
+			if (this != &v)
+			{
+				soa_vector temp(v);
+				swap(temp);
+			}
+			return *this;
+		}
+
+		soa_vector &operator=(soa_vector &&v)
+		{
+			if (this != &v)
+			{
+				clear();
+				deallocate();
+				swap(v);
+			}
+			return *this;
+		}
+
+		~soa_vector()
+		{
+			clear();
+			deallocate();
+		}
+
+		iterator begin()
+		{
+			return iterator(columns, 0);
+		}
+
+		const_iterator begin() const
+		{
+			return const_iterator(iterator(columns, 0));
+		}
+
+		iterator end()
+		{
+			return iterator(columns, count);
+		}
+
+		const_iterator end() const
+		{
+			return const_iterator(iterator(columns, count));
+		}
+
+		size_type size() const
+		{
+			return count;
+		}
+
+		size_type capacity() const
+		{
+			return cap;
+		}
+
+		bool empty() const
+		{
+			return count == 0;
+		}
+
+		//行代理：各分量是对各列元素的引用
+		reference operator[](size_type n)
+		{
+			return make_row(n, column_indices());
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return make_row(n, column_indices());
+		}
+
+		reference front()
+		{
+			return (*this)[0];
+		}
+
+		reference back()
+		{
+			return (*this)[count - 1];
+		}
+
+		//第I列的连续存储
+		template <size_t I>
+		column_type<I> *column_data()
+		{
+			return std::get<I>(columns);
+		}
+
+		template <size_t I>
+		const column_type<I> *column_data() const
+		{
+			return std::get<I>(columns);
+		}
+
+		template <size_t I>
+		subrange<column_type<I> *> column()
+		{
+			return subrange<column_type<I> *>(std::get<I>(columns), std::get<I>(columns) + count);
+		}
+
+		template <size_t I>
+		subrange<const column_type<I> *> column() const
+		{
+			return subrange<const column_type<I> *>(std::get<I>(columns), std::get<I>(columns) + count);
+		}
+
+		void push_back(const Ts &... values)
+		{
+			if (count == cap)
+			{
+				value_type row(values...);             //values可能就在本容器中
+				relocate(vector_growth_double::next_capacity(cap, count + 1, 0));
+				construct_row(count, row, column_indices());
+			}
+			else
+			{
+				construct_row(count, std::tuple<const Ts &...>(values...), column_indices());
+			}
+			++count;
+		}
+
+		void push_back(const value_type &row)
+		{
+			if (count == cap)
+			{
+				value_type row_copy(row);
+				relocate(vector_growth_double::next_capacity(cap, count + 1, 0));
+				construct_row(count, row_copy, column_indices());
+			}
+			else
+			{
+				construct_row(count, row, column_indices());
+			}
+			++count;
+		}
+
+		void pop_back()
+		{
+			--count;
+			destroy_rows(columns, count, count + 1, sizeof...(Ts), column_indices());
+		}
+
+		void resize(size_type new_size, const value_type &row)
+		{
+			if (new_size < count)
+			{
+				destroy_rows(columns, new_size, count, sizeof...(Ts), column_indices());
+				count = new_size;
+				return;
+			}
+			if (new_size > cap)
+			{
+				value_type row_copy(row);
+				relocate(vector_growth_double::next_capacity(cap, new_size, 0));
+				while (count < new_size)
+				{
+					construct_row(count, row_copy, column_indices());
+					++count;
+				}
+				return;
+			}
+			while (count < new_size)
+			{
+				construct_row(count, row, column_indices());
+				++count;
+			}
+		}
+
+		void resize(size_type new_size)
+		{
+			resize(new_size, value_type());
+		}
+
+		void reserve(size_type n)
+		{
+			if (n > cap)
+			{
+				relocate(n);
+			}
+		}
+
+		void clear()
+		{
+			destroy_rows(columns, 0, count, sizeof...(Ts), column_indices());
+			count = 0;
+		}
+
+		void swap(soa_vector &v)
+		{
+			my_STL::swap(columns, v.columns);
+			my_STL::swap(count, v.count);
+			my_STL::swap(cap, v.cap);
+			my_STL::swap(block, v.block);
+			my_STL::swap(block_bytes, v.block_bytes);
+		}
+	};
+
+	template <typename... Ts>
+	const size_t soa_vector<Ts...>::column_count;
+
+	/***********************************************************************/
+	//soa_vector
+	/***********************************************************************/
+	template <typename... Ts>
+	void soa_vector<Ts...>::relocate(size_type n)
+	{
+		size_type offsets[sizeof...(Ts)];
+		const size_type bytes = layout(n, offsets) + __SOA_COLUMN_ALIGN - 1;
+		char *new_block = static_cast<char *>(alloc::allocate(bytes));
+		char *base = reinterpret_cast<char *>((reinterpret_cast<size_t>(new_block) + __SOA_COLUMN_ALIGN - 1)
+			& ~size_t(__SOA_COLUMN_ALIGN - 1));
+		columns_type new_columns = make_columns(base, offsets, column_indices());
+		try
+		{
+			copy_rows(columns, count, new_columns, column_indices());
+		}
+		catch (...)
+		{
+			alloc::deallocate(new_block, bytes);
+			throw;
+		}
+
+		destroy_rows(columns, 0, count, sizeof...(Ts), column_indices());
+		deallocate();
+		columns = new_columns;
+		cap = n;
+		block = new_block;
+		block_bytes = bytes;
+	}
+
+	template <typename... Ts>
+	void soa_vector<Ts...>::deallocate()
+	{
+		if (block)
+		{
+			alloc::deallocate(block, block_bytes);
+		}
+		columns = columns_type();
+		cap = 0;
+		block = nullptr;
+		block_bytes = 0;
+	}
+
+	template <typename... Ts>
+	inline void swap(soa_vector<Ts...> &a, soa_vector<Ts...> &b)
+	{
+		a.swap(b);
+	}
+	//****************************************
+}
+
+#endif // !__SOA_VECTOR_H
@@ -0,0 +1,745 @@
+#ifndef __SORT_H
+#define __SORT_H
+
+#include "__Allocator.h"
+#include "__Algorithm.h"
+#include "__Construct.h"
+#include "__Heap.h"
+#include "__Iterator.h"
+#include "__Type_traits.h"
+#include "__Uninitialized.h"
+
+namespace my_STL
+{
+	enum
+	{
+		__STABLE_SORT_MIN_MERGE = 32,          //短于此长度的区间直接做二分插入排序
+		__STABLE_SORT_MIN_GALLOP = 7,          //一侧连续胜出此次数后进入galloping
+		__STABLE_SORT_MAX_RUNS = 85            //run栈深度上限(足以容纳2^64个元素)
+	};
+
+	//__temporary_buffer
+	//****************************************
+	//向allocator请求临时空间，失败时减半重试，最终可能得到0个元素
+	template <typename T>
+	class __temporary_buffer
+	{
+	private:
+		T *buffer;
+		ptrdiff_t len;
+
+		//POD型别不需要构造
+		void initialize(const T &, __true_type) {}
+
+		void initialize(const T &seed, __false_type)
+		{
+			uninitialized_fill_n(buffer, len, seed);
+		}
+
+		__temporary_buffer(const __temporary_buffer &);
+		__temporary_buffer &operator=(const __temporary_buffer &);
+
+	public:
+		__temporary_buffer(ptrdiff_t requested, const T &seed) :buffer(nullptr), len(requested)
+		{
+			while (len > 0)
+			{
+				buffer = allocator<T>::allocate(len);
+				if (buffer)
+				{
+					break;
+				}
+				len /= 2;
+			}
+			if (buffer)
+			{
+				using is_POD = typename __type_traits<T>::is_POD_type;
+				initialize(seed, is_POD());
+			}
+			else
+			{
+				len = 0;
+			}
+		}
+
+		~__temporary_buffer()
+		{
+			if (buffer)
+			{
+				destroy(buffer, buffer + len);
+				allocator<T>::deallocate(buffer, len);
+			}
+		}
+
+		T *begin()
+		{
+			return buffer;
+		}
+
+		ptrdiff_t size() const
+		{
+			return len;
+		}
+	};
+	//****************************************
+
+	//galloping search
+	//****************************************
+	//pred在区间上形如 false...false true...true，返回第一个true的位置
+	template <typename RandomAccessIterator, typename Predicate>
+	RandomAccessIterator __partition_point(RandomAccessIterator first, RandomAccessIterator last, Predicate pred)
+	{
+		typename iterator_traits<RandomAccessIterator>::difference_type len = last - first;
+		while (len > 0)
+		{
+			typename iterator_traits<RandomAccessIterator>::difference_type half = len >> 1;
+			if (pred(first[half]))
+			{
+				len = half;
+			}
+			else
+			{
+				first += half + 1;
+				len -= half + 1;
+			}
+		}
+		return first;
+	}
+
+	//从first开始按1, 2, 4, ...的步长探测，再在最后一段中二分
+	template <typename RandomAccessIterator, typename Predicate>
+	RandomAccessIterator __gallop_forward(RandomAccessIterator first, RandomAccessIterator last, Predicate pred)
+	{
+		ptrdiff_t len = last - first;
+		ptrdiff_t prev = 0;
+		ptrdiff_t ofs = 1;
+		while (ofs <= len && !pred(first[ofs - 1]))
+		{
+			prev = ofs;
+			ofs = 2 * ofs;
+		}
+		return __partition_point(first + prev, first + (ofs < len ? ofs : len), pred);
+	}
+
+	//从last开始向前探测
+	template <typename RandomAccessIterator, typename Predicate>
+	RandomAccessIterator __gallop_backward(RandomAccessIterator first, RandomAccessIterator last, Predicate pred)
+	{
+		ptrdiff_t len = last - first;
+		ptrdiff_t prev = 0;
+		ptrdiff_t ofs = 1;
+		while (ofs <= len && pred(first[len - ofs]))
+		{
+			prev = ofs;
+			ofs = 2 * ofs;
+		}
+		return __partition_point(first + (ofs <= len ? len - ofs + 1 : 0), first + (len - prev), pred);
+	}
+
+	//!comp(x, value)，即 x >= value
+	template <typename T, typename Compare>
+	struct __not_less_than
+	{
+		const T &value;
+		Compare comp;
+		__not_less_than(const T &v, Compare c) :value(v), comp(c) {}
+		template <typename U>
+		bool operator()(const U &x)
+		{
+			return !comp(x, value);
+		}
+	};
+
+	//comp(value, x)，即 x > value
+	template <typename T, typename Compare>
+	struct __greater_than
+	{
+		const T &value;
+		Compare comp;
+		__greater_than(const T &v, Compare c) :value(v), comp(c) {}
+		template <typename U>
+		bool operator()(const U &x)
+		{
+			return comp(value, x);
+		}
+	};
+
+	template <typename RandomAccessIterator, typename T, typename Compare>
+	inline RandomAccessIterator __gallop_lower_bound(RandomAccessIterator first, RandomAccessIterator last,
+		const T &value, Compare comp)
+	{
+		return __gallop_forward(first, last, __not_less_than<T, Compare>(value, comp));
+	}
+
+	template <typename RandomAccessIterator, typename T, typename Compare>
+	inline RandomAccessIterator __gallop_upper_bound(RandomAccessIterator first, RandomAccessIterator last,
+		const T &value, Compare comp)
+	{
+		return __gallop_forward(first, last, __greater_than<T, Compare>(value, comp));
+	}
+
+	template <typename RandomAccessIterator, typename T, typename Compare>
+	inline RandomAccessIterator __gallop_lower_bound_backward(RandomAccessIterator first, RandomAccessIterator last,
+		const T &value, Compare comp)
+	{
+		return __gallop_backward(first, last, __not_less_than<T, Compare>(value, comp));
+	}
+
+	template <typename RandomAccessIterator, typename T, typename Compare>
+	inline RandomAccessIterator __gallop_upper_bound_backward(RandomAccessIterator first, RandomAccessIterator last,
+		const T &value, Compare comp)
+	{
+		return __gallop_backward(first, last, __greater_than<T, Compare>(value, comp));
+	}
+	//****************************************
+
+	//merge with buffer
+	//****************************************
+	//len1 <= buffer_size：把[first, middle)移入buffer，从前往后合并
+	template <typename RandomAccessIterator, typename Pointer, typename Compare>
+	void __merge_lo(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+		Pointer buffer, Compare comp)
+	{
+		Pointer b = buffer;
+		Pointer b_end = copy(first, middle, buffer);
+		RandomAccessIterator r = middle;
+		RandomAccessIterator out = first;
+		int wins_b = 0;
+		int wins_r = 0;
+		while (b != b_end && r != last)
+		{
+			if (comp(*r, *b))
+			{
+				*out = *r;
+				++out, ++r;
+				++wins_r;
+				wins_b = 0;
+			}
+			else
+			{
+				*out = *b;
+				++out, ++b;
+				++wins_b;
+				wins_r = 0;
+			}
+
+			//某一侧连续胜出，整段搬移
+			if (b == b_end || r == last)
+			{
+				break;
+			}
+			if (wins_b >= __STABLE_SORT_MIN_GALLOP)
+			{
+				Pointer k = __gallop_upper_bound(b, b_end, *r, comp);
+				out = copy(b, k, out);
+				b = k;
+				wins_b = 0;
+			}
+			else if (wins_r >= __STABLE_SORT_MIN_GALLOP)
+			{
+				RandomAccessIterator k = __gallop_lower_bound(r, last, *b, comp);
+				out = copy(r, k, out);
+				r = k;
+				wins_r = 0;
+			}
+		}
+		//[r, last)已就位
+		copy(b, b_end, out);
+	}
+
+	//len2 <= buffer_size：把[middle, last)移入buffer，从后往前合并
+	template <typename RandomAccessIterator, typename Pointer, typename Compare>
+	void __merge_hi(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+		Pointer buffer, Compare comp)
+	{
+		Pointer b = copy(middle, last, buffer);
+		RandomAccessIterator l = middle;
+		RandomAccessIterator out = last;
+		int wins_b = 0;
+		int wins_l = 0;
+		while (first != l && buffer != b)
+		{
+			if (comp(*(b - 1), *(l - 1)))
+			{
+				*--out = *--l;
+				++wins_l;
+				wins_b = 0;
+			}
+			else
+			{
+				*--out = *--b;
+				++wins_b;
+				wins_l = 0;
+			}
+
+			if (first == l || buffer == b)
+			{
+				break;
+			}
+			if (wins_b >= __STABLE_SORT_MIN_GALLOP)
+			{
+				Pointer k = __gallop_lower_bound_backward(buffer, b, *(l - 1), comp);
+				out = copy_backward(k, b, out);
+				b = k;
+				wins_b = 0;
+			}
+			else if (wins_l >= __STABLE_SORT_MIN_GALLOP)
+			{
+				RandomAccessIterator k = __gallop_upper_bound_backward(first, l, *(b - 1), comp);
+				out = copy_backward(k, l, out);
+				l = k;
+				wins_l = 0;
+			}
+		}
+		//[first, l)已就位
+		copy_backward(buffer, b, out);
+	}
+
+	//buffer足够时直接合并，否则按SGI的做法切分、rotate后递归；buffer_size为0时即为原地合并
+	template <typename RandomAccessIterator, typename Distance, typename Pointer, typename Compare>
+	void __merge_adaptive(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+		Distance len1, Distance len2, Pointer buffer, Distance buffer_size, Compare comp)
+	{
+		if (len1 == 0 || len2 == 0)
+		{
+			return;
+		}
+		if (len1 <= len2 && len1 <= buffer_size)
+		{
+			__merge_lo(first, middle, last, buffer, comp);
+		}
+		else if (len2 <= buffer_size)
+		{
+			__merge_hi(first, middle, last, buffer, comp);
+		}
+		else if (len1 + len2 == 2)
+		{
+			if (comp(*middle, *first))
+			{
+				iter_swap(first, middle);
+			}
+		}
+		else
+		{
+			RandomAccessIterator first_cut = first;
+			RandomAccessIterator second_cut = middle;
+			Distance len11 = 0;
+			Distance len22 = 0;
+			if (len1 > len2)
+			{
+				len11 = len1 / 2;
+				first_cut = first + len11;
+				second_cut = lower_bound(middle, last, *first_cut, comp);
+				len22 = second_cut - middle;
+			}
+			else
+			{
+				len22 = len2 / 2;
+				second_cut = middle + len22;
+				first_cut = upper_bound(first, middle, *second_cut, comp);
+				len11 = first_cut - first;
+			}
+			RandomAccessIterator new_middle = rotate(first_cut, middle, second_cut);
+			__merge_adaptive(first, first_cut, new_middle, len11, len22, buffer, buffer_size, comp);
+			__merge_adaptive(new_middle, second_cut, last, len1 - len11, len2 - len22, buffer, buffer_size, comp);
+		}
+	}
+	//****************************************
+
+	//stable_sort
+	//****************************************
+	//natural merge sort：识别已有的升序/严格降序run，短run用二分插入补齐到min_run，
+	//按TimSort的栈规则合并相邻run，合并前用galloping裁掉已就位的两端
+	template <typename RandomAccessIterator, typename Compare>
+	void __binary_insertion_sort(RandomAccessIterator first, RandomAccessIterator last,
+		RandomAccessIterator start, Compare comp)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		for (; start != last; ++start)
+		{
+			value pivot = *start;
+			RandomAccessIterator pos = upper_bound(first, start, pivot, comp);
+			copy_backward(pos, start, start + 1);
+			*pos = pivot;
+		}
+	}
+
+	//返回从first开始的run长度，严格降序的run会被原地反转
+	template <typename RandomAccessIterator, typename Compare>
+	ptrdiff_t __count_run_and_make_ascending(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		RandomAccessIterator run_hi = first + 1;
+		if (run_hi == last)
+		{
+			return 1;
+		}
+		if (comp(*run_hi, *first))
+		{
+			++run_hi;
+			while (run_hi != last && comp(*run_hi, *(run_hi - 1)))
+			{
+				++run_hi;
+			}
+			reverse(first, run_hi);
+		}
+		else
+		{
+			++run_hi;
+			while (run_hi != last && !comp(*run_hi, *(run_hi - 1)))
+			{
+				++run_hi;
+			}
+		}
+		return run_hi - first;
+	}
+
+	inline ptrdiff_t __min_run_length(ptrdiff_t n)
+	{
+		ptrdiff_t r = 0;
+		while (n >= __STABLE_SORT_MIN_MERGE)
+		{
+			r |= n & 1;
+			n >>= 1;
+		}
+		return n + r;
+	}
+
+	//合并栈中第i、i+1两个run
+	template <typename RandomAccessIterator, typename T, typename Compare>
+	void __merge_at(RandomAccessIterator first, ptrdiff_t *run_base, ptrdiff_t *run_len, int &stack_size, int i,
+		__temporary_buffer<T> &buf, Compare comp)
+	{
+		RandomAccessIterator base1 = first + run_base[i];
+		ptrdiff_t len1 = run_len[i];
+		RandomAccessIterator base2 = first + run_base[i + 1];
+		ptrdiff_t len2 = run_len[i + 1];
+
+		run_len[i] = len1 + len2;
+		if (i == stack_size - 3)
+		{
+			run_base[i + 1] = run_base[i + 2];
+			run_len[i + 1] = run_len[i + 2];
+		}
+		--stack_size;
+
+		//run1中不大于run2首元素的前缀已就位
+		RandomAccessIterator k = __gallop_upper_bound(base1, base2, *base2, comp);
+		len1 -= k - base1;
+		base1 = k;
+		if (len1 == 0)
+		{
+			return;
+		}
+
+		//run2中不小于run1末元素的后缀已就位
+		len2 = __gallop_lower_bound_backward(base2, base2 + len2, *(base2 - 1), comp) - base2;
+		if (len2 == 0)
+		{
+			return;
+		}
+
+		__merge_adaptive(base1, base2, base2 + len2, len1, len2, buf.begin(), buf.size(), comp);
+	}
+
+	template <typename RandomAccessIterator, typename T, typename Compare>
+	void __merge_collapse(RandomAccessIterator first, ptrdiff_t *run_base, ptrdiff_t *run_len, int &stack_size,
+		__temporary_buffer<T> &buf, Compare comp)
+	{
+		while (stack_size > 1)
+		{
+			int n = stack_size - 2;
+			if ((n > 0 && run_len[n - 1] <= run_len[n] + run_len[n + 1])
+				|| (n > 1 && run_len[n - 2] <= run_len[n - 1] + run_len[n]))
+			{
+				if (run_len[n - 1] < run_len[n + 1])
+				{
+					--n;
+				}
+			}
+			else if (run_len[n] > run_len[n + 1])
+			{
+				break;
+			}
+			__merge_at(first, run_base, run_len, stack_size, n, buf, comp);
+		}
+	}
+
+	template <typename RandomAccessIterator, typename T, typename Compare>
+	void __stable_sort(RandomAccessIterator first, RandomAccessIterator last, T*, Compare comp)
+	{
+		ptrdiff_t n = last - first;
+		if (n < 2)
+		{
+			return;
+		}
+		if (n < __STABLE_SORT_MIN_MERGE)
+		{
+			ptrdiff_t run = __count_run_and_make_ascending(first, last, comp);
+			__binary_insertion_sort(first, last, first + run, comp);
+			return;
+		}
+
+		//合并时只需把较短的run移入buffer
+		__temporary_buffer<T> buf((n + 1) / 2, *first);
+		ptrdiff_t min_run = __min_run_length(n);
+		ptrdiff_t run_base[__STABLE_SORT_MAX_RUNS];
+		ptrdiff_t run_len[__STABLE_SORT_MAX_RUNS];
+		int stack_size = 0;
+
+		ptrdiff_t lo = 0;
+		while (lo < n)
+		{
+			ptrdiff_t run = __count_run_and_make_ascending(first + lo, last, comp);
+			if (run < min_run)
+			{
+				ptrdiff_t force = n - lo < min_run ? n - lo : min_run;
+				__binary_insertion_sort(first + lo, first + lo + force, first + lo + run, comp);
+				run = force;
+			}
+			run_base[stack_size] = lo;
+			run_len[stack_size] = run;
+			++stack_size;
+			__merge_collapse(first, run_base, run_len, stack_size, buf, comp);
+			lo += run;
+		}
+
+		while (stack_size > 1)
+		{
+			int i = stack_size - 2;
+			if (i > 0 && run_len[i - 1] < run_len[i + 1])
+			{
+				--i;
+			}
+			__merge_at(first, run_base, run_len, stack_size, i, buf, comp);
+		}
+	}
+
+	template <typename RandomAccessIterator>
+	inline void stable_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		__stable_sort(first, last, value_type(first), __less<value>());
+	}
+
+	template <typename RandomAccessIterator, typename Compare>
+	inline void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		__stable_sort(first, last, value_type(first), comp);
+	}
+	//****************************************
+
+	//inplace_merge
+	//****************************************
+	//临时空间只需容纳较短的一段；配置不到时退化为rotate原地合并
+	template <typename RandomAccessIterator, typename T, typename Compare>
+	void __inplace_merge(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+		T*, Compare comp)
+	{
+		ptrdiff_t len1 = middle - first;
+		ptrdiff_t len2 = last - middle;
+		if (len1 == 0 || len2 == 0)
+		{
+			return;
+		}
+		__temporary_buffer<T> buf(len1 < len2 ? len1 : len2, *first);
+		__merge_adaptive(first, middle, last, len1, len2, buf.begin(), buf.size(), comp);
+	}
+
+	template <typename RandomAccessIterator>
+	inline void inplace_merge(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		__inplace_merge(first, middle, last, value_type(first), __less<value>());
+	}
+
+	template <typename RandomAccessIterator, typename Compare>
+	inline void inplace_merge(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+		Compare comp)
+	{
+		__inplace_merge(first, middle, last, value_type(first), comp);
+	}
+	//****************************************
+
+	//partial_sort
+	//****************************************
+	//把[first, last)中最小的middle - first个元素放入[first, middle)，并保持为堆
+	template <typename RandomAccessIterator, typename Compare>
+	void __heap_select(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+		Compare comp)
+	{
+		make_heap(first, middle, comp);
+		for (RandomAccessIterator i = middle; i < last; ++i)
+		{
+			if (comp(*i, *first))
+			{
+				__pop_heap(first, middle, i, comp);
+			}
+		}
+	}
+
+	template <typename RandomAccessIterator, typename Compare>
+	inline void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+		Compare comp)
+	{
+		__heap_select(first, middle, last, comp);
+		sort_heap(first, middle, comp);
+	}
+
+	template <typename RandomAccessIterator>
+	inline void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		partial_sort(first, middle, last, __less<value>());
+	}
+	//****************************************
+
+	//partial_sort_copy
+	//****************************************
+	template <typename InputIterator, typename RandomAccessIterator, typename Compare>
+	RandomAccessIterator partial_sort_copy(InputIterator first, InputIterator last,
+		RandomAccessIterator result_first, RandomAccessIterator result_last, Compare comp)
+	{
+		using distance = typename iterator_traits<RandomAccessIterator>::difference_type;
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		if (result_first == result_last)
+		{
+			return result_last;
+		}
+		RandomAccessIterator result_real_last = result_first;
+		while (first != last && result_real_last != result_last)
+		{
+			*result_real_last = *first;
+			++result_real_last;
+			++first;
+		}
+		make_heap(result_first, result_real_last, comp);
+		for (; first != last; ++first)
+		{
+			if (comp(*first, *result_first))
+			{
+				__adjust_heap(result_first, distance(0), distance(result_real_last - result_first),
+					value(*first), comp);
+			}
+		}
+		sort_heap(result_first, result_real_last, comp);
+		return result_real_last;
+	}
+
+	template <typename InputIterator, typename RandomAccessIterator>
+	inline RandomAccessIterator partial_sort_copy(InputIterator first, InputIterator last,
+		RandomAccessIterator result_first, RandomAccessIterator result_last)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		return partial_sort_copy(first, last, result_first, result_last, __less<value>());
+	}
+	//****************************************
+
+	//nth_element
+	//****************************************
+	enum
+	{
+		__INTROSELECT_THRESHOLD = 16             //短于此长度时直接插入排序
+	};
+
+	template <typename RandomAccessIterator, typename Compare>
+	void __move_median_to_first(RandomAccessIterator result, RandomAccessIterator a, RandomAccessIterator b,
+		RandomAccessIterator c, Compare comp)
+	{
+		if (comp(*a, *b))
+		{
+			if (comp(*b, *c))
+				iter_swap(result, b);
+			else if (comp(*a, *c))
+				iter_swap(result, c);
+			else
+				iter_swap(result, a);
+		}
+		else if (comp(*a, *c))
+			iter_swap(result, a);
+		else if (comp(*b, *c))
+			iter_swap(result, c);
+		else
+			iter_swap(result, b);
+	}
+
+	//以*pivot为轴分割[first, last)，pivot不在区间内
+	template <typename RandomAccessIterator, typename Compare>
+	RandomAccessIterator __unguarded_partition(RandomAccessIterator first, RandomAccessIterator last,
+		RandomAccessIterator pivot, Compare comp)
+	{
+		while (true)
+		{
+			while (comp(*first, *pivot))
+				++first;
+			--last;
+			while (comp(*pivot, *last))
+				--last;
+			if (!(first < last))
+				return first;
+			iter_swap(first, last);
+			++first;
+		}
+	}
+
+	//三点取中作轴放到*first，返回分割点
+	template <typename RandomAccessIterator, typename Compare>
+	inline RandomAccessIterator __unguarded_partition_pivot(RandomAccessIterator first, RandomAccessIterator last,
+		Compare comp)
+	{
+		RandomAccessIterator mid = first + (last - first) / 2;
+		__move_median_to_first(first, first + 1, mid, last - 1, comp);
+		return __unguarded_partition(first + 1, last, first, comp);
+	}
+
+	//quickselect，分割层数超过2*log(n)时改用heap select，保证最坏O(nlogn)
+	template <typename RandomAccessIterator, typename Compare>
+	void __introselect(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last,
+		int depth_limit, Compare comp)
+	{
+		while (last - first > __INTROSELECT_THRESHOLD)
+		{
+			if (depth_limit == 0)
+			{
+				__heap_select(first, nth + 1, last, comp);
+				iter_swap(first, nth);            //堆顶即第nth小的元素
+				return;
+			}
+			--depth_limit;
+			RandomAccessIterator cut = __unguarded_partition_pivot(first, last, comp);
+			if (cut <= nth)
+				first = cut;
+			else
+				last = cut;
+		}
+		if (last - first > 1)
+		{
+			__binary_insertion_sort(first, last, first + 1, comp);
+		}
+	}
+
+	template <typename RandomAccessIterator, typename Compare>
+	inline void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last,
+		Compare comp)
+	{
+		if (first == last || nth == last)
+		{
+			return;
+		}
+		int depth_limit = 0;
+		for (ptrdiff_t n = last - first; n > 1; n >>= 1)
+		{
+			depth_limit += 2;
+		}
+		__introselect(first, nth, last, depth_limit, comp);
+	}
+
+	template <typename RandomAccessIterator>
+	inline void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+	{
+		using value = typename iterator_traits<RandomAccessIterator>::value_type;
+		nth_element(first, nth, last, __less<value>());
+	}
+	//****************************************
+}
+
+#endif // !__SORT_H
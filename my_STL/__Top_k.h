@@ -0,0 +1,291 @@
+#ifndef __TOP_K_H
+#define __TOP_K_H
+
+#include <type_traits>
+#include "__Config.h"
+#include "__Algorithm.h"
+#include "__Heap.h"
+#include "__Iterator.h"
+
+#ifdef __STL_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace my_STL
+{
+	//__top_k_filter
+	//****************************************
+	//在[first, last)中找第一个满足comp(threshold, x)的元素，即可能进入top_k的候选
+	template <typename T, typename Compare>
+	struct __top_k_filter
+	{
+		static const T *find(const T *first, const T *last, const T &threshold, Compare &comp)
+		{
+			while (first != last && !comp(threshold, *first))
+			{
+				++first;
+			}
+			return first;
+		}
+	};
+
+	//以下特化用SIMD一次比较8个(double为4个)元素，整块都不超过阈值时直接跳过
+	template <>
+	struct __top_k_filter<float, __less<float>>
+	{
+		static const float *find(const float *first, const float *last, float threshold, __less<float> &)
+		{
+#ifdef __STL_USE_SSE2
+			__m128 t = _mm_set1_ps(threshold);
+			for (; last - first >= 8; first += 8)
+			{
+				__m128 m = _mm_or_ps(_mm_cmpgt_ps(_mm_loadu_ps(first), t),
+					_mm_cmpgt_ps(_mm_loadu_ps(first + 4), t));
+				if (_mm_movemask_ps(m))
+				{
+					break;
+				}
+			}
+#endif
+			while (first != last && !(threshold < *first))
+			{
+				++first;
+			}
+			return first;
+		}
+	};
+
+	template <>
+	struct __top_k_filter<double, __less<double>>
+	{
+		static const double *find(const double *first, const double *last, double threshold, __less<double> &)
+		{
+#ifdef __STL_USE_SSE2
+			__m128d t = _mm_set1_pd(threshold);
+			for (; last - first >= 4; first += 4)
+			{
+				__m128d m = _mm_or_pd(_mm_cmpgt_pd(_mm_loadu_pd(first), t),
+					_mm_cmpgt_pd(_mm_loadu_pd(first + 2), t));
+				if (_mm_movemask_pd(m))
+				{
+					break;
+				}
+			}
+#endif
+			while (first != last && !(threshold < *first))
+			{
+				++first;
+			}
+			return first;
+		}
+	};
+
+	template <>
+	struct __top_k_filter<int, __less<int>>
+	{
+		static const int *find(const int *first, const int *last, int threshold, __less<int> &)
+		{
+#ifdef __STL_USE_SSE2
+			__m128i t = _mm_set1_epi32(threshold);
+			for (; last - first >= 8; first += 8)
+			{
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + 4));
+				__m128i m = _mm_or_si128(_mm_cmpgt_epi32(a, t), _mm_cmpgt_epi32(b, t));
+				if (_mm_movemask_epi8(m))
+				{
+					break;
+				}
+			}
+#endif
+			while (first != last && !(threshold < *first))
+			{
+				++first;
+			}
+			return first;
+		}
+	};
+
+	template <>
+	struct __top_k_filter<unsigned int, __less<unsigned int>>
+	{
+		static const unsigned int *find(const unsigned int *first, const unsigned int *last,
+			unsigned int threshold, __less<unsigned int> &)
+		{
+#ifdef __STL_USE_SSE2
+			//SSE2没有无符号比较，两边同时翻转符号位后做有符号比较
+			__m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+			__m128i t = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(threshold)), bias);
+			for (; last - first >= 8; first += 8)
+			{
+				__m128i a = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(first)), bias);
+				__m128i b = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(first + 4)), bias);
+				__m128i m = _mm_or_si128(_mm_cmpgt_epi32(a, t), _mm_cmpgt_epi32(b, t));
+				if (_mm_movemask_epi8(m))
+				{
+					break;
+				}
+			}
+#endif
+			while (first != last && !(threshold < *first))
+			{
+				++first;
+			}
+			return first;
+		}
+	};
+	//****************************************
+
+	//top_k
+	//****************************************
+	//流式保留comp意义下最大的K个元素，容量固定，不配置内存
+	template <typename T, size_t K, typename Compare = __less<T>>
+	class top_k
+	{
+		static_assert(K > 0, "top_k requires K > 0");
+
+	public:
+		using value_type = T;
+		using const_iterator = const T*;
+		using size_type = size_t;
+
+	protected:
+		T heap[K];                          //按comp的逆序组织成堆，heap[0]为已保留元素中最小者
+		size_type count;
+		Compare comp;
+
+		__reverse_compare<Compare> heap_compare() const
+		{
+			return __reverse_compare<Compare>(comp);
+		}
+
+		//用x替换堆顶并下沉
+		void replace_top(const T &x)
+		{
+			my_STL::__adjust_heap(heap, ptrdiff_t(0), ptrdiff_t(count), x, heap_compare());
+		}
+
+		//连续空间：元素类型正是T时才能按T扫描，其余指针逐个push
+		template <typename U>
+		void push_range(U *first, U *last)
+		{
+			push_pointer_range(first, last, typename std::is_same<typename std::remove_const<U>::type, T>::type());
+		}
+
+		template <typename U>
+		void push_pointer_range(U *first, U *last, std::false_type)
+		{
+			for (; first != last; ++first)
+			{
+				push(*first);
+			}
+		}
+
+		//先用__top_k_filter跳过不超过阈值的元素，只有候选才触碰堆
+		void push_pointer_range(const T *first, const T *last, std::true_type)
+		{
+			for (; first != last && count < K; ++first)
+			{
+				push(*first);
+			}
+			const T *p = first;
+			const T *end = last;
+			while (p != end)
+			{
+				p = __top_k_filter<T, Compare>::find(p, end, heap[0], comp);
+				if (p == end)
+				{
+					break;
+				}
+				replace_top(*p);
+				++p;
+			}
+		}
+
+		template <typename InputIterator>
+		void push_range(InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+			{
+				push(*first);
+			}
+		}
+
+	public:
+		top_k() :count(0), comp() {}
+		explicit top_k(Compare c) :count(0), comp(c) {}
+
+		void push(const T &x)
+		{
+			if (count < K)
+			{
+				heap[count++] = x;
+				my_STL::push_heap(heap, heap + count, heap_compare());
+			}
+			else if (comp(heap[0], x))
+			{
+				replace_top(x);
+			}
+		}
+
+		template <typename InputIterator>
+		void push(InputIterator first, InputIterator last)
+		{
+			push_range(first, last);
+		}
+
+		//当前进入top_k所需超过的值，仅在full()时有意义
+		const T &threshold() const
+		{
+			return heap[0];
+		}
+
+		size_type size() const
+		{
+			return count;
+		}
+
+		static size_type capacity()
+		{
+			return K;
+		}
+
+		bool empty() const
+		{
+			return count == 0;
+		}
+
+		bool full() const
+		{
+			return count == K;
+		}
+
+		void clear()
+		{
+			count = 0;
+		}
+
+		//堆序，不保证有序
+		const_iterator begin() const
+		{
+			return heap;
+		}
+
+		const_iterator end() const
+		{
+			return heap + count;
+		}
+
+		//按从大到小的顺序写入result，返回写入区间的尾端
+		template <typename RandomAccessIterator>
+		RandomAccessIterator sorted_copy(RandomAccessIterator result) const
+		{
+			RandomAccessIterator last = my_STL::copy(heap, heap + count, result);
+			my_STL::sort_heap(result, last, heap_compare());
+			return last;
+		}
+	};
+	//****************************************
+}
+
+#endif // !__TOP_K_H
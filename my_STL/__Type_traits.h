@@ -66,6 +66,26 @@ namespace my_STL
 		using is_POD_type = __true_type;
 	};
 
+	template <>
+	struct __type_traits<char16_t>
+	{
+		using has_trivial_default_constructor = __true_type;
+		using has_trivial_copy_constructor = __true_type;
+		using has_trivial_assignment_operator = __true_type;
+		using has_trivial_destructor = __true_type;
+		using is_POD_type = __true_type;
+	};
+
+	template <>
+	struct __type_traits<char32_t>
+	{
+		using has_trivial_default_constructor = __true_type;
+		using has_trivial_copy_constructor = __true_type;
+		using has_trivial_assignment_operator = __true_type;
+		using has_trivial_destructor = __true_type;
+		using is_POD_type = __true_type;
+	};
+
 	template <>
 	struct __type_traits<short>
 	{
@@ -195,6 +215,104 @@ namespace my_STL
 		using has_trivial_destructor = __true_type;
 		using is_POD_type = __true_type;
 	};
+
+	//是否为整数型别
+	//以迭代器区间为参数的成员模板据此区分(n, value)形式的调用，如vector<int>(5, 3)
+	template <typename T>
+	struct __is_integer
+	{
+		using integral = __false_type;
+	};
+
+	template <>
+	struct __is_integer<bool>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<char>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<signed char>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<unsigned char>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<wchar_t>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<char16_t>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<char32_t>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<short>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<unsigned short>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<int>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<unsigned int>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<long>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<unsigned long>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<long long>
+	{
+		using integral = __true_type;
+	};
+
+	template <>
+	struct __is_integer<unsigned long long>
+	{
+		using integral = __true_type;
+	};
 }
 
 #endif // !__TYPE_TRAITS_H_
@@ -23,18 +23,18 @@ namespace my_STL
 		return __uninitialized_copy_aux(first, last, result, is_POD());
 	}
 
-	//PODͱ
+	//是POD型别
 	template <typename InputIterator, typename ForwardIterator>
 	inline ForwardIterator __uninitialized_copy_aux(InputIterator first, InputIterator last, ForwardIterator result, __true_type)
 	{
 		return copy(first, last, result);
 	}
 
-	//PODͱ
+	//不是POD型别
 	template <typename InputIterator, typename ForwardIterator>
 	ForwardIterator __uninitialized_copy_aux(InputIterator first, InputIterator last, ForwardIterator result, __false_type)
 	{
-		ForwarIterator cur = result;
+		ForwardIterator cur = result;
 		for (; first != last; ++first, ++cur)
 		{
 			construct(&*cur, *first);
@@ -42,14 +42,14 @@ namespace my_STL
 		return cur;
 	}
 
-	//ػ const char*
+	//特化版 const char*
 	inline char *uninitialized_copy(const char* first, const char *last, char *result)
 	{
 		memmove(result, first, last - first);
 		return result + (last - first);
 	}
 
-	//ػ const wchar_t*
+	//特化版 const wchar_t*
 	inline wchar_t *uninitialized_copy(const wchar_t *first, const wchar_t *last, wchar_t *result)
 	{
 		memmove(result, first, last - first);
@@ -72,14 +72,14 @@ namespace my_STL
 		__uninitialized_fill_aux(first, last, x, is_POD());
 	}
 
-	//PODͱ
+	//是POD型别
 	template <typename ForwardIterator, typename T>
 	inline void __uninitialized_fill_aux(ForwardIterator first, ForwardIterator last, const T &x, __true_type)
 	{
 		fill(first, last, x);
 	}
 
-	//PODͱ
+	//不是POD型别
 	template <typename ForwardIterator, typename T>
 	void __uninitialized_fill_aux(ForwardIterator first, ForwardIterator last, const T &x, __false_type)
 	{
@@ -106,14 +106,14 @@ namespace my_STL
 		return __uninitialized_fill_n_aux(first, n, x, is_POD());
 	}
 
-	//PODͱ
+	//是POD型别
 	template <typename ForwardIterator, typename Size, typename T>
 	inline ForwardIterator __uninitialized_fill_n_aux(ForwardIterator first, Size n, const T &x, __true_type)
 	{
 		return fill_n(first, n, x);
 	}
 
-	//PODͱ
+	//不是POD型别
 	template <typename ForwardIterator, typename Size, typename T>
 	ForwardIterator __uninitialized_fill_n_aux(ForwardIterator first, Size n, const T &x, __false_type)
 	{
@@ -125,6 +125,51 @@ namespace my_STL
 		return cur;
 	}
 	//****************************************
+
+	//uninitialized_default_n
+	//****************************************
+	//默认初始化n个元素：trivial默认构造的型别什么都不做（不清零），内容留给调用者覆写
+	template <typename ForwardIterator, typename Size>
+	inline ForwardIterator uninitialized_default_n(ForwardIterator first, Size n)
+	{
+		return __uninitialized_default_n(first, n, value_type(first));
+	}
+
+	template <typename ForwardIterator, typename Size, typename V>
+	inline ForwardIterator __uninitialized_default_n(ForwardIterator first, Size n, V*)
+	{
+		using trivial_ctor = typename __type_traits<V>::has_trivial_default_constructor;
+		return __uninitialized_default_n_aux(first, n, trivial_ctor());
+	}
+
+	//有trivial default constructor
+	template <typename ForwardIterator, typename Size>
+	inline ForwardIterator __uninitialized_default_n_aux(ForwardIterator first, Size n, __true_type)
+	{
+		advance(first, n);
+		return first;
+	}
+
+	//没有trivial default constructor，构造失败时析构已构造的部分
+	template <typename ForwardIterator, typename Size>
+	ForwardIterator __uninitialized_default_n_aux(ForwardIterator first, Size n, __false_type)
+	{
+		ForwardIterator cur = first;
+		try
+		{
+			for (; n > 0; --n, ++cur)
+			{
+				::new(static_cast<void *>(&*cur)) typename iterator_traits<ForwardIterator>::value_type;
+			}
+		}
+		catch (...)
+		{
+			destroy(first, cur);
+			throw;
+		}
+		return cur;
+	}
+	//****************************************
 }
 #endif // !__UNINITIALIZED_H
 
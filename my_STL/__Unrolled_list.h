@@ -0,0 +1,685 @@
+#ifndef __UNROLLED_LIST_H
+#define __UNROLLED_LIST_H
+
+#include <initializer_list>
+#include <type_traits>
+#include "__Allocator.h"
+#include "__Construct.h"
+#include "__Uninitialized.h"
+#include "__Algorithm.h"
+#include "__Iterator.h"
+#include "__Segmented_iterator.h"
+#include "__Type_traits.h"
+
+namespace my_STL
+{
+	//__unrolled_node
+	//****************************************
+	//头节点只有链接部分；数据节点在其后放至多B个元素，[0, count)已构造
+	struct __unrolled_node_base
+	{
+		__unrolled_node_base *prev;
+		__unrolled_node_base *next;
+		size_t count;
+	};
+
+	template <typename T, size_t B>
+	struct __unrolled_node :public __unrolled_node_base
+	{
+		typename std::aligned_storage<sizeof(T) * B, alignof(T)>::type storage;
+
+		T *data()
+		{
+			return reinterpret_cast<T *>(&storage);
+		}
+
+		static T *data(__unrolled_node_base *p)
+		{
+			return static_cast<__unrolled_node *>(p)->data();
+		}
+	};
+	//****************************************
+
+	//__unrolled_list_iterator
+	//****************************************
+	//(节点, 节点内下标)，下标总小于节点的count；end()为(头节点, 0)
+	template <typename T, typename Ref, typename Ptr, size_t B>
+	struct __unrolled_list_iterator
+	{
+		using iterator_category = bidirectional_iterator_tag;
+		using value_type = T;
+		using difference_type = ptrdiff_t;
+		using pointer = Ptr;
+		using reference = Ref;
+		using iterator = __unrolled_list_iterator<T, T&, T*, B>;
+		using node_type = __unrolled_node<T, B>;
+
+		__unrolled_node_base *node;
+		size_t index;
+
+		__unrolled_list_iterator() :node(nullptr), index(0) {}
+		__unrolled_list_iterator(__unrolled_node_base *x, size_t i) :node(x), index(i) {}
+		__unrolled_list_iterator(const iterator &it) :node(it.node), index(it.index) {}
+
+		reference operator*() const
+		{
+			return node_type::data(node)[index];
+		}
+
+		pointer operator->() const
+		{
+			return &**this;
+		}
+
+		bool operator==(const __unrolled_list_iterator &it) const
+		{
+			return node == it.node && index == it.index;
+		}
+
+		bool operator!=(const __unrolled_list_iterator &it) const
+		{
+			return !(*this == it);
+		}
+
+		__unrolled_list_iterator &operator++()
+		{
+			if (++index == node->count)
+			{
+				node = node->next;
+				index = 0;
+			}
+			return *this;
+		}
+
+		__unrolled_list_iterator operator++(int)
+		{
+			__unrolled_list_iterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		__unrolled_list_iterator &operator--()
+		{
+			if (index == 0)
+			{
+				node = node->prev;
+				index = node->count;
+			}
+			--index;
+			return *this;
+		}
+
+		__unrolled_list_iterator operator--(int)
+		{
+			__unrolled_list_iterator temp = *this;
+			--*this;
+			return temp;
+		}
+	};
+
+	//段迭代器：数据节点
+	struct __unrolled_list_segment
+	{
+		__unrolled_node_base *node;
+
+		explicit __unrolled_list_segment(__unrolled_node_base *p) :node(p) {}
+
+		__unrolled_list_segment &operator++()
+		{
+			node = node->next;
+			return *this;
+		}
+
+		bool operator==(const __unrolled_list_segment &s) const
+		{
+			return node == s.node;
+		}
+
+		bool operator!=(const __unrolled_list_segment &s) const
+		{
+			return node != s.node;
+		}
+	};
+	//****************************************
+
+	//unrolled_list
+	//****************************************
+	//每个节点放至多B个元素的双向链表：遍历时一次载入的缓存行上有多个元素
+	//插入时节点满则对半分裂，删除后节点不足半满且能与后继装进一个节点时合并
+	//插入、删除使同一节点（以及分裂、合并所涉节点）中元素的迭代器失效，其余不受影响
+	//splice以整个节点为单位搬移，至多在两端各分裂一次
+	template <typename T, size_t B = (64 / sizeof(T) > 4 ? 64 / sizeof(T) : 4)>
+	class unrolled_list
+	{
+		static_assert(B >= 2, "unrolled_list requires at least two elements per node");
+
+	public:
+		using value_type = T;
+		using pointer = value_type*;
+		using iterator = __unrolled_list_iterator<T, T&, T*, B>;
+		using const_iterator = __unrolled_list_iterator<T, const T&, const T*, B>;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+
+	protected:
+		using base_type = __unrolled_node_base;
+		using node_type = __unrolled_node<T, B>;
+		using node_allocator = allocator<node_type>;
+
+		base_type header;          //头节点，header.next为第一个数据节点
+		size_type length;
+
+		static T *data(base_type *p)
+		{
+			return node_type::data(p);
+		}
+
+		void empty_initialize()
+		{
+			header.prev = header.next = &header;
+			header.count = 0;
+			length = 0;
+		}
+
+		//在pos之前接入一个空节点
+		base_type *create_node(base_type *pos)
+		{
+			base_type *p = node_allocator::allocate();
+			p->count = 0;
+			p->next = pos;
+			p->prev = pos->prev;
+			pos->prev->next = p;
+			pos->prev = p;
+			return p;
+		}
+
+		//节点须已空
+		void destroy_node(base_type *p)
+		{
+			p->prev->next = p->next;
+			p->next->prev = p->prev;
+			node_allocator::deallocate(static_cast<node_type *>(p));
+		}
+
+		//把p的后n个元素搬到新建于p之后的节点
+		base_type *split(base_type *p, size_type n);
+
+		//p不足半满且能与后继装进一个节点时，把后继并进p
+		void merge_next(base_type *p);
+
+		//迭代器指向头节点以外的某个节点的末尾时，改为指向下一节点的开头
+		static iterator normalize(base_type *p, size_type i)
+		{
+			return i == p->count && p->count != 0 ? iterator(p->next, 0) : iterator(p, i);
+		}
+
+		template <typename Integer>
+		void initialize_aux(Integer n, Integer value, __true_type)
+		{
+			for (size_type i = static_cast<size_type>(n); i != 0; --i)
+			{
+				push_back(static_cast<T>(value));
+			}
+		}
+
+		template <typename InputIterator>
+		void initialize_aux(InputIterator first, InputIterator last, __false_type)
+		{
+			for (; first != last; ++first)
+			{
+				push_back(*first);
+			}
+		}
+
+	public:
+		unrolled_list()
+		{
+			empty_initialize();
+		}
+
+		unrolled_list(size_type n, const T &x)
+		{
+			empty_initialize();
+			try
+			{
+				for (; n != 0; --n)
+				{
+					push_back(x);
+				}
+			}
+			catch (...)
+			{
+				clear();
+				throw;
+			}
+		}
+
+		template <typename InputIterator>
+		unrolled_list(InputIterator first, InputIterator last)
+		{
+			empty_initialize();
+			try
+			{
+				using integral = typename __is_integer<InputIterator>::integral;
+				initialize_aux(first, last, integral());
+			}
+			catch (...)
+			{
+				clear();
+				throw;
+			}
+		}
+
+		unrolled_list(std::initializer_list<T> il)
+		{
+			empty_initialize();
+			try
+			{
+				initialize_aux(il.begin(), il.end(), __false_type());
+			}
+			catch (...)
+			{
+				clear();
+				throw;
+			}
+		}
+
+		unrolled_list(const unrolled_list &l);
+
+		unrolled_list &operator=(const unrolled_list &l)
+		{
+			if (this != &l)
+			{
+				unrolled_list temp(l);
+				swap(temp);
+			}
+			return *this;
+		}
+
+		~unrolled_list()
+		{
+			clear();
+		}
+
+		iterator begin()
+		{
+			return iterator(header.next, 0);
+		}
+
+		const_iterator begin() const
+		{
+			return const_iterator(header.next, 0);
+		}
+
+		iterator end()
+		{
+			return iterator(&header, 0);
+		}
+
+		const_iterator end() const
+		{
+			return const_iterator(const_cast<base_type *>(&header), 0);
+		}
+
+		size_type size() const
+		{
+			return length;
+		}
+
+		bool empty() const
+		{
+			return length == 0;
+		}
+
+		reference front()
+		{
+			return *data(header.next);
+		}
+
+		reference back()
+		{
+			return data(header.prev)[header.prev->count - 1];
+		}
+
+		iterator insert(iterator pos, const T &x);
+		iterator erase(iterator pos);
+
+		iterator erase(iterator first, iterator last)
+		{
+			//逐个删除会合并节点，last可能随之失效：先数出个数
+			size_type n = 0;
+			for (iterator it = first; it != last; ++it)
+			{
+				++n;
+			}
+			for (; n != 0; --n)
+			{
+				first = erase(first);
+			}
+			return first;
+		}
+
+		void push_back(const T &x)
+		{
+			insert(end(), x);
+		}
+
+		void push_front(const T &x)
+		{
+			insert(begin(), x);
+		}
+
+		void pop_back()
+		{
+			erase(iterator(header.prev, header.prev->count - 1));
+		}
+
+		void pop_front()
+		{
+			erase(begin());
+		}
+
+		void clear();
+
+		//把other的全部元素整节点地搬到pos之前；pos在节点中间时先把该节点分开
+		void splice(iterator pos, unrolled_list &other);
+
+		//把other的[first, last)搬到pos之前，至多在两端各分裂一次；other须是另一个链表
+		void splice(iterator pos, unrolled_list &other, iterator first, iterator last);
+
+		void swap(unrolled_list &l);
+	};
+
+	/***********************************************************************/
+	//unrolled_list
+	/***********************************************************************/
+	template <typename T, size_t B>
+	unrolled_list<T, B>::unrolled_list(const unrolled_list &l)
+	{
+		empty_initialize();
+		try
+		{
+			//整节点复制，保持同样的装填程度
+			for (base_type *p = l.header.next; p != &l.header; p = p->next)
+			{
+				base_type *q = create_node(&header);
+				uninitialized_copy(data(p), data(p) + p->count, data(q));
+				q->count = p->count;
+				length += p->count;
+			}
+		}
+		catch (...)
+		{
+			clear();
+			throw;
+		}
+	}
+
+	template <typename T, size_t B>
+	typename unrolled_list<T, B>::base_type *unrolled_list<T, B>::split(base_type *p, size_type n)
+	{
+		base_type *q = create_node(p->next);
+		T *from = data(p) + (p->count - n);
+		try
+		{
+			uninitialized_copy(from, from + n, data(q));
+		}
+		catch (...)
+		{
+			destroy_node(q);
+			throw;
+		}
+		destroy(from, from + n);
+		q->count = n;
+		p->count -= n;
+		return q;
+	}
+
+	template <typename T, size_t B>
+	void unrolled_list<T, B>::merge_next(base_type *p)
+	{
+		base_type *q = p->next;
+		if (q == &header || p->count >= B / 2 || p->count + q->count > B)
+		{
+			return;
+		}
+		uninitialized_copy(data(q), data(q) + q->count, data(p) + p->count);
+		destroy(data(q), data(q) + q->count);
+		p->count += q->count;
+		q->count = 0;
+		destroy_node(q);
+	}
+
+	template <typename T, size_t B>
+	typename unrolled_list<T, B>::iterator unrolled_list<T, B>::insert(iterator pos, const T &x)
+	{
+		T x_copy = x;                  //x可能就在本链表中
+		base_type *p = pos.node;
+		size_type i = pos.index;
+		//在节点开头插入而前一节点未满时，接到前一节点末尾，不必搬移
+		if (i == 0 && p->prev != &header && p->prev->count < B)
+		{
+			p = p->prev;
+			i = p->count;
+		}
+		else if (p == &header)
+		{
+			p = create_node(&header);
+			i = 0;
+		}
+		else if (p->count == B)
+		{
+			base_type *q = split(p, B / 2);
+			if (i > p->count)
+			{
+				i -= p->count;
+				p = q;
+			}
+		}
+		T *d = data(p);
+		if (i == p->count)
+		{
+			construct(d + i, x_copy);
+		}
+		else
+		{
+			construct(d + p->count, d[p->count - 1]);
+			copy_backward(d + i, d + p->count - 1, d + p->count);
+			d[i] = x_copy;
+		}
+		++p->count;
+		++length;
+		return iterator(p, i);
+	}
+
+	template <typename T, size_t B>
+	typename unrolled_list<T, B>::iterator unrolled_list<T, B>::erase(iterator pos)
+	{
+		base_type *p = pos.node;
+		const size_type i = pos.index;
+		T *d = data(p);
+		copy(d + i + 1, d + p->count, d + i);
+		destroy(d + p->count - 1);
+		--p->count;
+		--length;
+		if (p->count == 0)
+		{
+			base_type *next = p->next;
+			destroy_node(p);
+			return iterator(next, 0);
+		}
+		//后继并入p时其元素接在p的末尾，i处仍是被删元素的下一个
+		merge_next(p);
+		return normalize(p, i);
+	}
+
+	template <typename T, size_t B>
+	void unrolled_list<T, B>::clear()
+	{
+		base_type *p = header.next;
+		while (p != &header)
+		{
+			base_type *next = p->next;
+			destroy(data(p), data(p) + p->count);
+			node_allocator::deallocate(static_cast<node_type *>(p));
+			p = next;
+		}
+		empty_initialize();
+	}
+
+	template <typename T, size_t B>
+	void unrolled_list<T, B>::splice(iterator pos, unrolled_list &other)
+	{
+		if (other.empty() || &other == this)
+		{
+			return;
+		}
+		base_type *p = pos.node;
+		if (pos.index != 0)
+		{
+			p = split(p, p->count - pos.index);
+		}
+		base_type *first = other.header.next;
+		base_type *last = other.header.prev;
+		other.header.prev = other.header.next = &other.header;
+		first->prev = p->prev;
+		last->next = p;
+		p->prev->next = first;
+		p->prev = last;
+		length += other.length;
+		other.length = 0;
+	}
+
+	template <typename T, size_t B>
+	void unrolled_list<T, B>::splice(iterator pos, unrolled_list &other, iterator first, iterator last)
+	{
+		if (first == last)
+		{
+			return;
+		}
+		//先在last处分裂，再在first处分裂，之后[first, last)恰为[start, stop)中的整节点
+		//first与last在同一节点时，第二次分裂出的节点也正好位于stop之前
+		base_type *stop = last.node;
+		if (last.index != 0)
+		{
+			stop = other.split(last.node, last.node->count - last.index);
+		}
+		base_type *start = first.node;
+		if (first.index != 0)
+		{
+			start = other.split(first.node, first.node->count - first.index);
+		}
+		size_type n = 0;
+		for (base_type *q = start; q != stop; q = q->next)
+		{
+			n += q->count;
+		}
+		base_type *tail = stop->prev;
+		start->prev->next = stop;
+		stop->prev = start->prev;
+		other.length -= n;
+
+		base_type *p = pos.node;
+		if (pos.index != 0)
+		{
+			p = split(p, p->count - pos.index);
+		}
+		start->prev = p->prev;
+		tail->next = p;
+		p->prev->next = start;
+		p->prev = tail;
+		length += n;
+	}
+
+	//头节点是成员：交换后要把首尾节点重新指回各自的头节点
+	template <typename T, size_t B>
+	void unrolled_list<T, B>::swap(unrolled_list &l)
+	{
+		my_STL::swap(header.next, l.header.next);
+		my_STL::swap(header.prev, l.header.prev);
+		my_STL::swap(length, l.length);
+		if (header.next == &l.header)
+		{
+			header.next = header.prev = &header;
+		}
+		else
+		{
+			header.next->prev = header.prev->next = &header;
+		}
+		if (l.header.next == &header)
+		{
+			l.header.next = l.header.prev = &l.header;
+		}
+		else
+		{
+			l.header.next->prev = l.header.prev->next = &l.header;
+		}
+	}
+
+	template <typename T, size_t B>
+	inline void swap(unrolled_list<T, B> &a, unrolled_list<T, B> &b)
+	{
+		a.swap(b);
+	}
+	//****************************************
+
+	//以节点为段：copy/find/for_each在节点内按指针遍历
+	//节点开头的迭代器归入前一节点的末尾（前一节点是头节点时除外），这样end()总落在最后一个数据节点上
+	template <typename T, typename Ref, typename Ptr, size_t B>
+	struct __segmented_iterator_traits<__unrolled_list_iterator<T, Ref, Ptr, B>>
+	{
+		using iterator = __unrolled_list_iterator<T, Ref, Ptr, B>;
+		using node_type = __unrolled_node<T, B>;
+		using is_segmented_iterator = __true_type;
+		using segment_iterator = __unrolled_list_segment;
+		using local_iterator = Ptr;
+
+		//链表为空时end()的节点没有数据区，local返回nullptr，此时不会再取段的区间
+		static bool is_header(__unrolled_node_base *p)
+		{
+			return p->count == 0;
+		}
+
+		static segment_iterator segment(const iterator &it)
+		{
+			if (it.index == 0 && !is_header(it.node->prev))
+			{
+				return segment_iterator(it.node->prev);
+			}
+			return segment_iterator(it.node);
+		}
+
+		static local_iterator local(const iterator &it)
+		{
+			if (it.index == 0 && !is_header(it.node->prev))
+			{
+				return node_type::data(it.node->prev) + it.node->prev->count;
+			}
+			return is_header(it.node) ? nullptr : node_type::data(it.node) + it.index;
+		}
+
+		static local_iterator begin(const segment_iterator &s)
+		{
+			return node_type::data(s.node);
+		}
+
+		static local_iterator end(const segment_iterator &s)
+		{
+			return node_type::data(s.node) + s.node->count;
+		}
+
+		static iterator compose(const segment_iterator &s, local_iterator p)
+		{
+			if (!p)
+			{
+				return iterator(s.node, 0);
+			}
+			const size_t i = p - begin(s);
+			return i == s.node->count ? iterator(s.node->next, 0) : iterator(s.node, i);
+		}
+	};
+}
+
+#endif // !__UNROLLED_LIST_H
@@ -8,7 +8,47 @@
 
 namespace my_STL
 {
-	template <typename T, typename Alloc = allocator<T>>
+	//增长策略
+	//****************************************
+	//next_capacity(old_capacity, required, size)：容量为old_capacity、至少需要容纳required个
+	//大小为size的元素时，返回新容量（不小于required）
+
+	//2倍
+	struct vector_growth_double
+	{
+		static size_t next_capacity(size_t old_capacity, size_t required, size_t)
+		{
+			size_t n = old_capacity != 0 ? 2 * old_capacity : 1;
+			return n < required ? required : n;
+		}
+	};
+
+	//1.5倍，释放的旧空间之和有机会被后续配置复用
+	struct vector_growth_half
+	{
+		static size_t next_capacity(size_t old_capacity, size_t required, size_t)
+		{
+			size_t n = old_capacity + old_capacity / 2;
+			if (n == old_capacity)
+			{
+				++n;
+			}
+			return n < required ? required : n;
+		}
+	};
+
+	//2倍后把字节数上调到alloc实际占用的大小，多出的部分计入容量而不浪费
+	struct vector_growth_size_class
+	{
+		static size_t next_capacity(size_t old_capacity, size_t required, size_t size)
+		{
+			size_t n = vector_growth_double::next_capacity(old_capacity, required, size);
+			return alloc::size_class(n * size) / size;
+		}
+	};
+	//****************************************
+
+	template <typename T, typename Alloc = allocator<T>, typename Growth = vector_growth_double>
 	class vector
 	{
 	public:
@@ -22,14 +62,14 @@ namespace my_STL
 		using difference_type = ptrdiff_t;
 
 	protected:
-		iterator start;            //ʹÿռͷ
-		iterator finish;           //ʹÿռβ
-		iterator cap;              //ÿռβ
+		iterator start;            //使用空间头部
+		iterator finish;           //使用空间尾部
+		iterator cap;              //可用空间尾部
 
 		using data_allocator = Alloc;
 
 	protected:
-		//ö
+		//配置而后填充
 		iterator allocate_and_fill(size_type n, const T &x)
 		{
 			iterator result = data_allocator::allocate(n);
@@ -37,7 +77,7 @@ namespace my_STL
 			return result;
 		}
 
-	   //ͷſռ
+	   //释放空间
 		void deallocate()
 		{
 			if (start)
@@ -46,7 +86,7 @@ namespace my_STL
 			}
 		}
 
-		//䲢ʼ
+		//填充并初始化
 		void fill_initialize(size_type n, const T &value)
 		{
 			start = allocate_and_fill(n, value);
@@ -54,14 +94,18 @@ namespace my_STL
 			cap = finish;
 		}
 
-		//㹻ڴΧԪأЩԪؿ·ڴ
+		//分配足够内存来保存给定范围的元素，并将这些元素拷贝到新分配的内存中
 		std::pair<T*, T*> alloc_n_copy(const T *b, const T *e)
 		{
+			if (b == e)                        //内存池不接受0字节的配置
+			{
+				return{ nullptr, nullptr };
+			}
 			auto data = data_allocator::allocate(e - b);
 			return{ data, uninitialized_copy(b, e, data) };
 		}
 
-		//destroyԪزͷſռ
+		//destroy元素并释放空间
 		void free()
 		{
 			if (start)
@@ -73,26 +117,129 @@ namespace my_STL
 
 		void insert_aux(iterator position, const T &x);
 
+		//尾端追加区间
+		template <typename InputIterator>
+		void range_append(InputIterator first, InputIterator last, input_iterator_tag)
+		{
+			for (; first != last; ++first)
+			{
+				push_back(*first);
+			}
+		}
+
+		//长度可知：至多配置一次，再整体uninitialized_copy（POD时为memmove）
+		template <typename ForwardIterator>
+		void range_append(ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+		{
+			__container_reserve(*this, distance(first, last));
+			finish = uninitialized_copy(first, last, finish);
+		}
+
+		//以区间初始化
+		template <typename Integer>
+		void initialize_aux(Integer n, Integer value, __true_type)
+		{
+			fill_initialize(static_cast<size_type>(n), static_cast<T>(value));
+		}
+
+		template <typename InputIterator>
+		void initialize_aux(InputIterator first, InputIterator last, __false_type)
+		{
+			range_initialize(first, last, iterator_category(first));
+		}
+
+		template <typename InputIterator>
+		void range_initialize(InputIterator first, InputIterator last, input_iterator_tag)
+		{
+			start = finish = cap = nullptr;
+			range_append(first, last, input_iterator_tag());
+		}
+
+		//长度可知：只配置一次
+		template <typename ForwardIterator>
+		void range_initialize(ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+		{
+			const size_type n = distance(first, last);
+			start = finish = cap = nullptr;
+			if (n != 0)
+			{
+				start = data_allocator::allocate(n);
+				try
+				{
+					finish = uninitialized_copy(first, last, start);
+				}
+				catch (...)
+				{
+					data_allocator::deallocate(start, n);
+					throw;
+				}
+				cap = start + n;
+			}
+		}
+
+		//assign
+		void fill_assign(size_type n, const T &value);
+
+		template <typename Integer>
+		void assign_dispatch(Integer n, Integer value, __true_type)
+		{
+			fill_assign(static_cast<size_type>(n), static_cast<T>(value));
+		}
+
+		template <typename InputIterator>
+		void assign_dispatch(InputIterator first, InputIterator last, __false_type)
+		{
+			range_assign(first, last, iterator_category(first));
+		}
+
+		template <typename InputIterator>
+		void range_assign(InputIterator first, InputIterator last, input_iterator_tag);
+		template <typename ForwardIterator>
+		void range_assign(ForwardIterator first, ForwardIterator last, forward_iterator_tag);
+
+		//区间insert
+		template <typename Integer>
+		void insert_dispatch(iterator position, Integer n, Integer value, __true_type)
+		{
+			insert(position, static_cast<size_type>(n), static_cast<T>(value));
+		}
+
+		template <typename InputIterator>
+		void insert_dispatch(iterator position, InputIterator first, InputIterator last, __false_type)
+		{
+			range_insert(position, first, last, iterator_category(first));
+		}
+
+		template <typename InputIterator>
+		void range_insert(iterator position, InputIterator first, InputIterator last, input_iterator_tag);
+		template <typename ForwardIterator>
+		void range_insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag);
+
+		template <typename BidirectionalIterator>
+		void insert_batch_aux(BidirectionalIterator first, BidirectionalIterator last, size_type n);
+
 	public:
-		//캯
+		//构造函数
 		vector() :start(nullptr), finish(nullptr), cap(nullptr) {}
 		vector(size_type n, const T &value);
 		vector(int n, const T &value);
 		vector(long n, const T &value);
 		vector(std::initializer_list<T> il);
 		explicit vector(size_type n);
+		template <typename InputIterator>
+		vector(InputIterator first, InputIterator last);
 
-		//
+		//拷贝构造
 		vector(const vector &v);
 
-		//ƶ
+		//移动构造
 		vector(vector &&v);
 
-		//
+		//析构函数
 		~vector();
 
-		reference operator=(const vector &rhs);
-		reference operator=(vector &&rhs);
+		vector &operator=(const vector &rhs);
+		vector &operator=(vector &&rhs);
 
 	public:
 		reference operator[](size_type n);
@@ -131,23 +278,29 @@ namespace my_STL
 			return size_type(cap - begin());
 		}
 
+		//元素个数的理论上限
+		size_type max_size() const
+		{
+			return size_type(-1) / sizeof(T);
+		}
+
 		bool empty() const
 		{
 			return begin() == end();
 		}
 
-		reference front()               //һԪ
+		reference front()               //第一个元素
 		{
 			return *begin();
 		}
 
-		reference back()               //һԪ
+		reference back()               //最后一个元素
 		{
 			return *(end() - 1);
 		}
 
 		//push_back
-		void push_back(const T &x)      //Ԫزβ
+		void push_back(const T &x)      //元素插入至尾端
 		{
 			if (finish != cap)
 			{
@@ -161,14 +314,14 @@ namespace my_STL
 		}
 
 		//pop_back
-		void pop_back()              //ȡβԪ
+		void pop_back()              //取出最尾端元素
 		{
 			--finish;
 			destroy(finish);
 		}
 
 		//erase
-		iterator erase(iterator first, iterator last)        //[first, last)еԪ
+		iterator erase(iterator first, iterator last)        //清除[first, last)中的元素
 		{
 			iterator i = copy(last, finish, first);
 			destroy(i, finish);
@@ -176,17 +329,37 @@ namespace my_STL
 			return first;
 		}
 
-		iterator erase(iterator position)        //ĳλԪ
+		iterator erase(iterator position)        //清除某位置上元素
 		{
 			if (position + 1 != end())
 			{
-				copy(position + 1, finish, position);      //Ԫǰƶ
+				copy(position + 1, finish, position);      //后面元素往前移动
 			}
 			--finish;
 			destroy(finish);
 			return position;
 		}
 
+		//以最后一个元素填补position，不保持次序，O(1)
+		iterator erase_unordered(iterator position)
+		{
+			if (position + 1 != finish)
+			{
+				*position = std::move(*(finish - 1));
+			}
+			pop_back();
+			return position;
+		}
+
+		//清除下标严格递增的一组元素，返回清除的个数；保留的元素成段前移，每个至多搬移一次
+		template <typename InputIterator>
+		size_type erase_indices(InputIterator first, InputIterator last);
+
+		//插入按位置非递减排列的(位置, 值)对，位置为插入前的下标，同一位置按输入次序排列
+		//现有元素每个至多搬移一次；值不能引用本vector中的元素
+		template <typename BidirectionalIterator>
+		void insert_batch(BidirectionalIterator first, BidirectionalIterator last);
+
 		//resize
 		void resize(size_type new_size, const T &x)
 		{
@@ -205,6 +378,81 @@ namespace my_STL
 			resize(new_size, T());
 		}
 
+		//新增的元素只做默认初始化，trivial默认构造的T不会被清零，调用者须在读之前覆写
+		void resize_for_overwrite(size_type new_size)
+		{
+			if (new_size < size())
+			{
+				erase(begin() + new_size, end());
+			}
+			else
+			{
+				__container_reserve(*this, new_size - size());
+				finish = uninitialized_default_n(finish, new_size - size());
+			}
+		}
+
+		//在尾端预留n个默认初始化的元素，交给writer(p, n)直接写入
+		//writer返回实际写入的个数m（m <= n），之后size()增加m；writer抛出异常时vector不变
+		template <typename Writer>
+		size_type reserve_and_append(size_type n, Writer writer);
+
+		//reserve
+		void reserve(size_type n)              //保证容量至少为n，不改变元素
+		{
+			if (capacity() < n)
+			{
+				iterator new_start = data_allocator::allocate(n);
+				iterator new_finish = new_start;
+				try
+				{
+					new_finish = uninitialized_copy(start, finish, new_start);
+				}
+				catch (...)
+				{
+					data_allocator::deallocate(new_start, n);
+					throw;
+				}
+
+				free();
+				start = new_start;
+				finish = new_finish;
+				cap = start + n;
+			}
+		}
+
+		//shrink_to_fit
+		void shrink_to_fit()                   //释放多余容量
+		{
+			if (finish == cap)
+			{
+				return;
+			}
+			if (start == finish)
+			{
+				deallocate();
+				start = finish = cap = nullptr;
+				return;
+			}
+			const size_type n = size();
+			iterator new_start = data_allocator::allocate(n);
+			iterator new_finish = new_start;
+			try
+			{
+				new_finish = uninitialized_copy(start, finish, new_start);
+			}
+			catch (...)
+			{
+				data_allocator::deallocate(new_start, n);
+				throw;
+			}
+
+			free();
+			start = new_start;
+			finish = new_finish;
+			cap = new_finish;
+		}
+
 		//clear
 		void clear()
 		{
@@ -213,29 +461,104 @@ namespace my_STL
 
 		//insert
 		void insert(iterator position, size_type n, const T &x);
-		void insert(iterator position, const T &x);
+		iterator insert(iterator position, const T &x);
+
+		template <typename InputIterator>
+		void insert(iterator position, InputIterator first, InputIterator last)
+		{
+			using integral = typename __is_integer<InputIterator>::integral;
+			insert_dispatch(position, first, last, integral());
+		}
+
+		//assign
+		void assign(size_type n, const T &value)
+		{
+			fill_assign(n, value);
+		}
+
+		template <typename InputIterator>
+		void assign(InputIterator first, InputIterator last)
+		{
+			using integral = typename __is_integer<InputIterator>::integral;
+			assign_dispatch(first, last, integral());
+		}
+
+		//append
+		template <typename InputIterator>
+		void append(InputIterator first, InputIterator last)
+		{
+			range_append(first, last, iterator_category(first));
+		}
 	};
 
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::vector(size_type n, const T &value)
+	//尺寸提示：至少再容纳n个元素；按增长策略增长，避免连续小批量追加时反复配置
+	template <typename T, typename Alloc, typename Growth, typename Size>
+	inline void __container_reserve(vector<T, Alloc, Growth> &v, Size n)
+	{
+		const size_t required = v.size() + static_cast<size_t>(n);
+		if (v.capacity() < required)
+		{
+			v.reserve(Growth::next_capacity(v.capacity(), required, sizeof(T)));
+		}
+	}
+
+	//清除满足pred的元素，返回清除的个数：一遍扫描，每个元素只调用一次pred
+	//保留的元素成段前移（trivial时为memmove），遇到要清除的元素时才把此前的一段搬走
+	template <typename T, typename Alloc, typename Growth, typename Predicate>
+	size_t erase_if(vector<T, Alloc, Growth> &v, Predicate pred)
+	{
+		T *first = v.begin();
+		T *last = v.end();
+		for (; first != last && !pred(*first); ++first) {}
+		if (first == last)
+		{
+			return 0;
+		}
+		T *result = first;
+		T *run = first + 1;                    //当前这段保留元素的起点
+		for (T *i = run; i != last; ++i)
+		{
+			if (pred(*i))
+			{
+				result = copy(run, i, result);
+				run = i + 1;
+			}
+		}
+		result = copy(run, last, result);
+		const size_t n = last - result;
+		v.erase(result, last);
+		return n;
+	}
+
+	//copy到vector的back_insert_iterator：整体追加，而不是n次push_back
+	template <typename InputIterator, typename T, typename Alloc, typename Growth>
+	inline back_insert_iterator<vector<T, Alloc, Growth>> copy(InputIterator first, InputIterator last,
+		back_insert_iterator<vector<T, Alloc, Growth>> result)
+	{
+		result.container->append(first, last);
+		return result;
+	}
+
+	template <typename T, typename Alloc, typename Growth>
+	vector<T, Alloc, Growth>::vector(size_type n, const T &value)
 	{
 		fill_initialize(n, value);
 	}
 
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::vector(int n, const T &value)
+	template <typename T, typename Alloc, typename Growth>
+	vector<T, Alloc, Growth>::vector(int n, const T &value)
 	{
 		fill_initialize(n, value);
 	}
 
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::vector(long n, const T &value)
+	template <typename T, typename Alloc, typename Growth>
+	vector<T, Alloc, Growth>::vector(long n, const T &value)
 	{
 		fill_initialize(n, value);
 	}
 
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::vector(std::initializer_list<T> il)
+	template <typename T, typename Alloc, typename Growth>
+	vector<T, Alloc, Growth>::vector(std::initializer_list<T> il)
 	{
 		T* const newdata = data_allocator::allocate(il.size());
 		T *p = newdata;
@@ -247,34 +570,43 @@ namespace my_STL
 		finish = cap = start + il.size();
 	}
 
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::vector(size_type n)
+	template <typename T, typename Alloc, typename Growth>
+	vector<T, Alloc, Growth>::vector(size_type n)
 	{
 		fill_initialize(n, T());
 	}
 
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::vector(const vector &v)
+	//forward iterator只配置一次；input iterator逐个push_back，按增长策略扩充
+	template <typename T, typename Alloc, typename Growth>
+	template <typename InputIterator>
+	vector<T, Alloc, Growth>::vector(InputIterator first, InputIterator last)
+	{
+		using integral = typename __is_integer<InputIterator>::integral;
+		initialize_aux(first, last, integral());
+	}
+
+	template <typename T, typename Alloc, typename Growth>
+	vector<T, Alloc, Growth>::vector(const vector &v)
 	{
 		auto newdata = alloc_n_copy(v.begin(), v.end());
 		start = newdata.first;
 		finish = cap = newdata.second;
 	}
 
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::vector(vector &&v) :start(v.start), finish(v.finish), cap(v.cap)
+	template <typename T, typename Alloc, typename Growth>
+	vector<T, Alloc, Growth>::vector(vector &&v) :start(v.start), finish(v.finish), cap(v.cap)
 	{
 		v.start = v.finish = v.cap = nullptr;
 	}
 
-	template <typename T, typename Alloc>
-	vector<T, Alloc>::~vector()
+	template <typename T, typename Alloc, typename Growth>
+	vector<T, Alloc, Growth>::~vector()
 	{
 		free();
 	}
 
-	template <typename T, typename Alloc>
-	typename vector<T, Alloc>::reference vector<T, Alloc>::operator=(const vector &rhs)
+	template <typename T, typename Alloc, typename Growth>
+	vector<T, Alloc, Growth> &vector<T, Alloc, Growth>::operator=(const vector &rhs)
 	{
 		if (this != &rhs)
 		{
@@ -286,8 +618,8 @@ namespace my_STL
 		return *this;
 	}
 
-	template <typename T, typename Alloc>
-	typename vector<T, Alloc>::reference vector<T, Alloc>::operator=(vector &&rhs)
+	template <typename T, typename Alloc, typename Growth>
+	vector<T, Alloc, Growth> &vector<T, Alloc, Growth>::operator=(vector &&rhs)
 	{
 		if (this != &rhs)
 		{
@@ -301,20 +633,20 @@ namespace my_STL
 		return *this;
 	}
 
-	template <typename T, typename Alloc>
-	typename vector<T, Alloc>::reference vector<T, Alloc>::operator[](size_type n)
+	template <typename T, typename Alloc, typename Growth>
+	typename vector<T, Alloc, Growth>::reference vector<T, Alloc, Growth>::operator[](size_type n)
 	{
 		return *(begin() + n);
 	}
 
-	template <typename T, typename Alloc>
-	typename vector<T, Alloc>::const_reference vector<T, Alloc>::operator[](size_type n) const
+	template <typename T, typename Alloc, typename Growth>
+	typename vector<T, Alloc, Growth>::const_reference vector<T, Alloc, Growth>::operator[](size_type n) const
 	{
 		return *(begin() + n);
 	}
 
-	template <typename T, typename Alloc>
-	bool vector<T, Alloc>::operator==(const vector &rhs) const
+	template <typename T, typename Alloc, typename Growth>
+	bool vector<T, Alloc, Growth>::operator==(const vector &rhs) const
 	{
 		if (size() != rhs.size())
 		{
@@ -335,76 +667,75 @@ namespace my_STL
 		}
 	}
 
-	template <typename T, typename Alloc>
-	bool vector<T, Alloc>::operator!=(const vector &rhs) const
+	template <typename T, typename Alloc, typename Growth>
+	bool vector<T, Alloc, Growth>::operator!=(const vector &rhs) const
 	{
 		return !(*this == rhs);
 	}
 
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::insert_aux(iterator position, const T &x)
+	template <typename T, typename Alloc, typename Growth>
+	void vector<T, Alloc, Growth>::insert_aux(iterator position, const T &x)
 	{
-		if (finish != cap)                               //пռ
+		if (finish != cap)                               //还有空间
 		{
-			//ڱÿռ俪ʼһԪأvectorһԪΪֵ
+			//在备用空间开始处构造一个元素，并用vector最后一个元素为其初值
 			construct(finish, *(finish - 1));
 			++finish;
 			T x_copy = x;
 			copy_backward(position, finish - 2, finish - 1);
 			*position = x_copy;
 		}
-		else                                             //ޱÿռ
+		else                                             //无备用空间
 		{
-			//ԭСΪ01ԭСΪ0ԭС2
-			const size_type old_size = size();
-			const size_type len = (old_size != 0) ? 2 * old_size : 1;
+			//新容量由增长策略决定
+			const size_type len = Growth::next_capacity(capacity(), size() + 1, sizeof(T));
 
 			iterator new_start = data_allocator::allocate(len);
 			iterator new_finish = new_start;
 			try
 			{
-				//ԭݿvector
+				//将原内容拷贝到新vector
 				new_finish = uninitialized_copy(start, position, new_start);
-				//ΪԪ趨ֵ
+				//为新元素设定初值
 				construct(new_finish, x);
 				++new_finish;
-				//ԭݿ
+				//将原安插点内容拷贝过来
 				new_finish = uninitialized_copy(position, finish, new_finish);
 			}
 			catch(...)
 			{
-				//ع
+				//回滚
 				destroy(new_start, new_finish);
 				data_allocator::deallocate(new_start, len);
 				throw;
 			}
 
-			free();            //ͷԭvector
+			free();            //析构并释放原vector
 			start = new_start;
 			finish = new_finish;
-			cap = new_finish + len;
+			cap = new_start + len;
 		}
 	}
 
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::insert(iterator position, size_type n, const T &x)
+	template <typename T, typename Alloc, typename Growth>
+	void vector<T, Alloc, Growth>::insert(iterator position, size_type n, const T &x)
 	{
 		if (n != 0)
 		{
-			if (size_type(cap - finish) >= n)            //ÿռڵԪظ
+			if (size_type(cap - finish) >= n)            //备用空间大于等于新增元素个数
 			{
 				T x_copy = x;
-				//֮Ԫظ
+				//计算插入点之后的现有元素个数
 				const size_type elems_after = finish - position;
 				iterator old_finish = finish;
-				if (elems_after > n)                     //֮ԪشԪظ
+				if (elems_after > n)                     //插入点之后的现有元素大于新增元素个数
 				{
 					uninitialized_copy(finish - n, finish, finish);
-					finish += n;                           //β˱Ǻ
+					finish += n;                           //尾端标记后移
 					copy_backward(position, old_finish - n, old_finish);
-					fill(position, position + n, x_copy);        //Ӳ㿪ʼֵ
+					fill(position, position + n, x_copy);        //从插入点开始填入新值
 				}
-				else                                     //֮ԪСڵԪظ
+				else                                     //插入点之后的现有元素小于等于新增元素个数
 				{
 					uninitialized_fill_n(finish, n - elems_after, x_copy);
 					finish += n - elems_after;
@@ -413,22 +744,21 @@ namespace my_STL
 					fill(position, old_finish, x_copy);
 				}
 			}
-			else                                         //ÿռСԪظ
+			else                                         //备用空间小于新增元素个数
 			{
-				//¿ռ䳤
-				const size_type old_size = size();
-				const size_type len = old_size + max(old_size, n);
+				//决定新空间长度
+				const size_type len = Growth::next_capacity(capacity(), size() + n, sizeof(T));
 
-				//µĿռ
+				//配置新的空间
 				iterator new_start = data_allocator::allocate(len);
 				iterator new_finish = new_start;
 				try
 				{
-					//vector֮ǰԪظƵ¿ռ
+					//将旧vector插入点之前的元素复制到新空间
 					new_finish = uninitialized_copy(start, position, new_start);
-					//Ԫ¿ռ
+					//将新增元素填入新空间
 					new_finish = uninitialized_fill_n(new_finish, n, x);
-					//vector֮ԪظƵ¿ռ
+					//将旧vector插入点之后的元素复制到新空间
 					new_finish = uninitialized_copy(position, finish, new_finish);
 				}
 				catch (...)
@@ -438,20 +768,330 @@ namespace my_STL
 					throw;
 				}
 
-				free();                             //ͷžvector
+				free();                             //清除并释放旧vector
 				start = new_start;
 				finish = new_finish;
-				cap = new_finish + len;
+				cap = new_start + len;
+			}
+		}
+	}
+
+	template <typename T, typename Alloc, typename Growth>
+	template <typename InputIterator>
+	void vector<T, Alloc, Growth>::range_insert(iterator position, InputIterator first, InputIterator last,
+		input_iterator_tag)
+	{
+		if (position == finish)
+		{
+			range_append(first, last, input_iterator_tag());
+			return;
+		}
+		for (; first != last; ++first)
+		{
+			position = insert(position, *first);
+			++position;
+		}
+	}
+
+	//长度可知：备用空间足够时原地搬移，否则只配置一次
+	template <typename T, typename Alloc, typename Growth>
+	template <typename ForwardIterator>
+	void vector<T, Alloc, Growth>::range_insert(iterator position, ForwardIterator first, ForwardIterator last,
+		forward_iterator_tag)
+	{
+		if (first == last)
+		{
+			return;
+		}
+		const size_type n = distance(first, last);
+		if (size_type(cap - finish) >= n)                 //备用空间足够
+		{
+			const size_type elems_after = finish - position;
+			iterator old_finish = finish;
+			if (elems_after > n)
+			{
+				uninitialized_copy(finish - n, finish, finish);
+				finish += n;
+				copy_backward(position, old_finish - n, old_finish);
+				copy(first, last, position);
+			}
+			else
+			{
+				ForwardIterator mid = first;
+				advance(mid, elems_after);
+				uninitialized_copy(mid, last, finish);
+				finish += n - elems_after;
+				uninitialized_copy(position, old_finish, finish);
+				finish += elems_after;
+				copy(first, mid, position);
+			}
+		}
+		else                                              //备用空间不足
+		{
+			const size_type len = Growth::next_capacity(capacity(), size() + n, sizeof(T));
+			iterator new_start = data_allocator::allocate(len);
+			iterator new_finish = new_start;
+			try
+			{
+				new_finish = uninitialized_copy(start, position, new_start);
+				new_finish = uninitialized_copy(first, last, new_finish);
+				new_finish = uninitialized_copy(position, finish, new_finish);
+			}
+			catch (...)
+			{
+				destroy(new_start, new_finish);
+				data_allocator::deallocate(new_start, len);
+				throw;
+			}
+
+			free();
+			start = new_start;
+			finish = new_finish;
+			cap = new_start + len;
+		}
+	}
+
+	template <typename T, typename Alloc, typename Growth>
+	template <typename InputIterator>
+	typename vector<T, Alloc, Growth>::size_type vector<T, Alloc, Growth>::erase_indices(InputIterator first,
+		InputIterator last)
+	{
+		if (first == last)
+		{
+			return 0;
+		}
+		iterator result = start + *first;
+		iterator src = result + 1;
+		for (++first; first != last; ++first)
+		{
+			iterator hole = start + *first;
+			result = copy(src, hole, result);
+			src = hole + 1;
+		}
+		result = copy(src, finish, result);
+		const size_type n = finish - result;
+		destroy(result, finish);
+		finish = result;
+		return n;
+	}
+
+	template <typename T, typename Alloc, typename Growth>
+	template <typename BidirectionalIterator>
+	void vector<T, Alloc, Growth>::insert_batch(BidirectionalIterator first, BidirectionalIterator last)
+	{
+		const size_type n = my_STL::distance(first, last);
+		if (n == 0)
+		{
+			return;
+		}
+		if (size_type(cap - finish) >= n)                 //备用空间足够：自后向前原地搬移
+		{
+			insert_batch_aux(first, last, n);
+			return;
+		}
+		const size_type len = Growth::next_capacity(capacity(), size() + n, sizeof(T));
+		iterator new_start = data_allocator::allocate(len);
+		iterator new_finish = new_start;
+		try
+		{
+			iterator src = start;
+			for (; first != last; ++first)
+			{
+				iterator position = start + first->first;
+				new_finish = uninitialized_copy(src, position, new_finish);
+				construct(new_finish, first->second);
+				++new_finish;
+				src = position;
+			}
+			new_finish = uninitialized_copy(src, finish, new_finish);
+		}
+		catch (...)
+		{
+			destroy(new_start, new_finish);
+			data_allocator::deallocate(new_start, len);
+			throw;
+		}
+
+		free();
+		start = new_start;
+		finish = new_finish;
+		cap = new_start + len;
+	}
+
+	//自后向前写：先填满尾端之后的备用空间（构造），之后才赋值到原有元素上
+	//填备用空间时抛出异常，原有元素未动，销毁已构造者即可；之后抛出异常时元素都有效但内容未定
+	template <typename T, typename Alloc, typename Growth>
+	template <typename BidirectionalIterator>
+	void vector<T, Alloc, Growth>::insert_batch_aux(BidirectionalIterator first, BidirectionalIterator last,
+		size_type n)
+	{
+		iterator old_finish = finish;
+		iterator result = finish + n;            //写入位置
+		iterator raw = result;                   //[raw, old_finish + n)为已构造的备用空间
+		iterator src = finish;                   //[start, src)为尚未搬移的原有元素
+		try
+		{
+			while (first != last)
+			{
+				--last;
+				iterator position = start + last->first;
+				//[position, src)后移到result之前：落在备用空间的部分先构造，其余整段copy_backward
+				if (result > old_finish && position != src)
+				{
+					const size_type raw_n = min(size_type(result - old_finish), size_type(src - position));
+					uninitialized_copy(src - raw_n, src, result - raw_n);
+					src -= raw_n;
+					result -= raw_n;
+					raw = result;
+				}
+				result = copy_backward(position, src, result);
+				src = position;
+				--result;
+				if (result >= old_finish)
+				{
+					construct(result, last->second);
+					raw = result;
+				}
+				else
+				{
+					*result = last->second;
+				}
+			}
+		}
+		catch (...)
+		{
+			if (raw != old_finish)
+			{
+				destroy(raw, old_finish + n);
+			}
+			else
+			{
+				finish = old_finish + n;
+			}
+			throw;
+		}
+		finish = old_finish + n;
+	}
+
+	template <typename T, typename Alloc, typename Growth>
+	template <typename Writer>
+	typename vector<T, Alloc, Growth>::size_type vector<T, Alloc, Growth>::reserve_and_append(size_type n,
+		Writer writer)
+	{
+		if (n == 0)
+		{
+			return 0;
+		}
+		__container_reserve(*this, n);
+		iterator last = uninitialized_default_n(finish, n);
+		size_type written;
+		try
+		{
+			written = writer(finish, n);
+		}
+		catch (...)
+		{
+			destroy(finish, last);
+			throw;
+		}
+		if (written > n)
+		{
+			written = n;
+		}
+		destroy(finish + written, last);
+		finish += written;
+		return written;
+	}
+
+	template <typename T, typename Alloc, typename Growth>
+	void vector<T, Alloc, Growth>::fill_assign(size_type n, const T &value)
+	{
+		T value_copy = value;                  //value可能就在本vector中
+		if (n > capacity())
+		{
+			iterator new_start = allocate_and_fill(n, value_copy);
+			free();
+			start = new_start;
+			finish = cap = new_start + n;
+		}
+		else if (n > size())
+		{
+			fill(start, finish, value_copy);
+			finish = uninitialized_fill_n(finish, n - size(), value_copy);
+		}
+		else
+		{
+			iterator i = fill_n(start, n, value_copy);
+			destroy(i, finish);
+			finish = i;
+		}
+	}
+
+	template <typename T, typename Alloc, typename Growth>
+	template <typename InputIterator>
+	void vector<T, Alloc, Growth>::range_assign(InputIterator first, InputIterator last, input_iterator_tag)
+	{
+		iterator cur = start;
+		for (; first != last && cur != finish; ++first, ++cur)
+		{
+			*cur = *first;
+		}
+		if (first == last)
+		{
+			erase(cur, finish);
+		}
+		else
+		{
+			range_append(first, last, input_iterator_tag());
+		}
+	}
+
+	template <typename T, typename Alloc, typename Growth>
+	template <typename ForwardIterator>
+	void vector<T, Alloc, Growth>::range_assign(ForwardIterator first, ForwardIterator last, forward_iterator_tag)
+	{
+		const size_type n = distance(first, last);
+		if (n > capacity())                    //重新配置一次
+		{
+			iterator new_start = data_allocator::allocate(n);
+			try
+			{
+				uninitialized_copy(first, last, new_start);
+			}
+			catch (...)
+			{
+				data_allocator::deallocate(new_start, n);
+				throw;
 			}
+			free();
+			start = new_start;
+			finish = cap = new_start + n;
+		}
+		else if (n <= size())
+		{
+			iterator i = copy(first, last, start);
+			destroy(i, finish);
+			finish = i;
+		}
+		else
+		{
+			ForwardIterator mid = first;
+			advance(mid, size());
+			copy(first, mid, start);
+			finish = uninitialized_copy(mid, last, finish);
 		}
 	}
 
-	template <typename T, typename Alloc>
-	void vector<T, Alloc>::insert(iterator position, const T &x)
+	template <typename T, typename Alloc, typename Growth>
+	typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::insert(iterator position, const T &x)
 	{
+		const size_type offset = position - start;
 		insert(position, 1, x);
+		return start + offset;
 	}
 }
 
+#include "__Bit_vector.h"
+
 #endif // !__VECTOR_H
 
@@ -0,0 +1,75 @@
+#ifndef __TEST_H
+#define __TEST_H
+
+#include <cstdio>
+#include <cstddef>
+
+//回归测试驱动
+//****************************************
+//每个test_*.cpp用TEST_CASE注册若干用例，用例内用CHECK检查条件，test_main.cpp统一运行
+//编译：cl /EHsc /I..\my_STL test_*.cpp ..\my_STL\__Alloc.cpp
+//运行：test [用例名前缀]，有失败时返回1
+namespace test
+{
+	typedef void(*case_function)();
+
+	struct case_entry
+	{
+		const char *name;
+		case_function run;
+	};
+
+	enum
+	{
+		__MAX_CASES = 256
+	};
+
+	inline case_entry *cases()
+	{
+		static case_entry table[__MAX_CASES];
+		return table;
+	}
+
+	inline size_t &case_count()
+	{
+		static size_t n = 0;
+		return n;
+	}
+
+	inline size_t &failures()
+	{
+		static size_t n = 0;
+		return n;
+	}
+
+	struct registrar
+	{
+		registrar(const char *name, case_function f)
+		{
+			if (case_count() != __MAX_CASES)
+			{
+				case_entry e = { name, f };
+				cases()[case_count()++] = e;
+			}
+		}
+	};
+
+	inline void check(bool ok, const char *expr, const char *file, int line)
+	{
+		if (!ok)
+		{
+			++failures();
+			std::printf("  %s:%d: CHECK(%s) failed\n", file, line, expr);
+		}
+	}
+}
+
+#define TEST_CASE(name) \
+	static void name(); \
+	static test::registrar name##_registrar(#name, name); \
+	static void name()
+
+#define CHECK(expr) test::check(static_cast<bool>(expr), #expr, __FILE__, __LINE__)
+//****************************************
+
+#endif // !__TEST_H
@@ -0,0 +1,39 @@
+#include "test.h"
+#include "__Vector.h"
+#include "__Bit_vector.h"
+#include "__Iterator.h"
+
+using my_STL::vector;
+
+TEST_CASE(bit_vector_find_empty)
+{
+	vector<bool> v;
+	CHECK(my_STL::find(v.begin(), v.end(), true) == v.end());
+	CHECK(my_STL::find(v.begin(), v.end(), false) == v.end());
+	const vector<bool> &c = v;
+	CHECK(my_STL::find(c.begin(), c.end(), true) == c.end());
+}
+
+//size为字长的整数倍时end()指向缓冲区之后的字，空区间不能读它
+TEST_CASE(bit_vector_find_at_word_boundary)
+{
+	vector<bool> v(128, false);
+	CHECK(my_STL::find(v.end(), v.end(), false) == v.end());
+	CHECK(my_STL::find(v.begin() + 64, v.begin() + 64, false) == v.begin() + 64);
+	CHECK(my_STL::find(v.begin(), v.end(), true) == v.end());
+	v[127] = true;
+	CHECK(my_STL::find(v.begin(), v.end(), true) == v.begin() + 127);
+	CHECK(my_STL::find(v.begin() + 64, v.end(), false) == v.begin() + 64);
+}
+
+TEST_CASE(bit_vector_copy_to_back_inserter)
+{
+	const bool a[] = { true, false, true };
+	vector<bool> bits;
+	my_STL::copy(a, a + 3, my_STL::back_inserter(bits));
+	CHECK(bits.size() == 3);
+	CHECK(bits[0] && !bits[1] && bits[2]);
+	my_STL::copy(a, a + 3, my_STL::back_inserter(bits));
+	CHECK(bits.size() == 6);
+	CHECK(my_STL::count(bits.begin(), bits.end(), true) == 4);
+}
@@ -0,0 +1,130 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "test.h"
+#include "__Concurrent_vector.h"
+
+using my_STL::concurrent_vector;
+
+namespace
+{
+	struct tagged
+	{
+		int value;
+		int tag;               //构造完成后为__TAG
+
+		enum
+		{
+			__TAG = 0x5a5a5a5a
+		};
+
+		explicit tagged(int x) :value(x), tag(__TAG) {}
+		tagged(tagged &&t) noexcept :value(t.value), tag(t.tag) {}
+	};
+
+	//把占下下标与发布拆开，模拟占下之后被挂起的线程
+	struct stalling_vector :public concurrent_vector<int>
+	{
+		size_t claim_one()
+		{
+			return claim(1);
+		}
+
+		void finish(size_t i, int x)
+		{
+			*slot(i) = x;
+			publish(i, 1);
+		}
+	};
+}
+
+//读者按size()逐个读取，写者同时push_back与grow_by：读到的下标都须已构造完成
+TEST_CASE(concurrent_vector_read_while_growing)
+{
+	concurrent_vector<tagged> v;
+	std::atomic<bool> done(false);
+	std::atomic<int> bad(0);
+	const int per_writer = 20000;
+
+	auto writer = [&](int id) {
+		for (int i = 0; i != per_writer; ++i)
+		{
+			v.push_back(tagged(id));
+		}
+	};
+	auto reader = [&] {
+		while (!done.load())
+		{
+			const size_t n = v.size();
+			for (size_t i = 0; i != n; ++i)
+			{
+				if (v[i].tag != tagged::__TAG)
+				{
+					++bad;
+				}
+			}
+			size_t m = 0;
+			for (auto it = v.begin(), last = v.end(); it != last; ++it, ++m)
+			{
+				if (it->tag != tagged::__TAG)
+				{
+					++bad;
+				}
+			}
+		}
+	};
+	std::thread r1(reader), r2(reader);
+	std::thread w1(writer, 1), w2(writer, 2), w3(writer, 3);
+	w1.join();
+	w2.join();
+	w3.join();
+	done.store(true);
+	r1.join();
+	r2.join();
+
+	CHECK(bad.load() == 0);
+	CHECK(v.size() == 3 * static_cast<size_t>(per_writer));
+}
+
+TEST_CASE(concurrent_vector_grow_by_publishes_whole_range)
+{
+	concurrent_vector<int> v;
+	const size_t first = v.grow_by(100, 7);
+	CHECK(first == 0);
+	CHECK(v.size() == 100);
+	CHECK(v.grow_by(0) == 100);
+	CHECK(v.size() == 100);
+	v.clear();
+	CHECK(v.size() == 0);
+	CHECK(v.push_back(1) == 0);
+	concurrent_vector<int> w(v);
+	CHECK(w.size() == 1);
+	CHECK(w.push_back(2) == 1);
+}
+
+//一个线程占下下标后迟迟不发布，其他线程的push_back不应等它；它发布后count一次推进到底
+TEST_CASE(concurrent_vector_stalled_claim_does_not_block)
+{
+	stalling_vector v;
+	const size_t stalled = v.claim_one();
+	std::atomic<int> finished(0);
+	auto writer = [&] {
+		for (int i = 0; i != 1000; ++i)
+		{
+			v.push_back(i);
+		}
+		++finished;
+	};
+	std::thread w1(writer), w2(writer);
+	for (int i = 0; i != 500 && finished.load() != 2; ++i)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	CHECK(finished.load() == 2);
+	CHECK(v.size() == 0);
+	v.finish(stalled, -1);
+	w1.join();
+	w2.join();
+	CHECK(v.size() == 2001);
+	CHECK(v[0] == -1);
+}
@@ -0,0 +1,21 @@
+#include <cstring>
+#include "test.h"
+
+int main(int argc, char **argv)
+{
+	const char *prefix = argc > 1 ? argv[1] : "";
+	size_t run = 0;
+	for (size_t i = 0; i != test::case_count(); ++i)
+	{
+		const test::case_entry &e = test::cases()[i];
+		if (std::strncmp(e.name, prefix, std::strlen(prefix)) == 0)
+		{
+			const size_t before = test::failures();
+			e.run();
+			std::printf("%s %s\n", test::failures() == before ? "ok  " : "FAIL", e.name);
+			++run;
+		}
+	}
+	std::printf("%zu cases, %zu failed checks\n", run, test::failures());
+	return test::failures() == 0 ? 0 : 1;
+}
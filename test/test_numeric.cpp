@@ -0,0 +1,73 @@
+#include <stdint.h>
+#include "test.h"
+#include "__Vector.h"
+#include "__Numeric.h"
+
+using my_STL::vector;
+
+namespace
+{
+	//仿射变换x -> a*x + b，复合满足结合律但不满足交换律
+	struct affine
+	{
+		uint32_t a, b;
+	};
+
+	//先做f再做g
+	struct compose
+	{
+		affine operator()(const affine &f, const affine &g) const
+		{
+			affine r = { g.a * f.a, g.a * f.b + g.b };
+			return r;
+		}
+	};
+
+	bool same(const affine &x, const affine &y)
+	{
+		return x.a == y.a && x.b == y.b;
+	}
+
+	//长度超过__SCAN_PARALLEL_THRESHOLD，确保走多线程路径
+	vector<affine> make_input()
+	{
+		vector<affine> v;
+		uint32_t s = 12345;
+		for (size_t i = 0; i != (size_t(1) << 17) + 7; ++i)
+		{
+			s = s * 1103515245u + 12345u;
+			affine f = { s | 1, s >> 7 };
+			v.push_back(f);
+		}
+		return v;
+	}
+}
+
+TEST_CASE(numeric_parallel_inclusive_scan_non_commutative)
+{
+	vector<affine> in = make_input();
+	vector<affine> expect(in.size()), got(in.size());
+	my_STL::inclusive_scan(in.begin(), in.end(), expect.begin(), compose());
+	my_STL::parallel_inclusive_scan(in.begin(), in.end(), got.begin(), compose(), 4);
+	bool ok = true;
+	for (size_t i = 0; i != in.size(); ++i)
+	{
+		ok = ok && same(expect[i], got[i]);
+	}
+	CHECK(ok);
+}
+
+TEST_CASE(numeric_parallel_exclusive_scan_non_commutative)
+{
+	vector<affine> in = make_input();
+	vector<affine> expect(in.size()), got(in.size());
+	affine id = { 1, 0 };
+	my_STL::exclusive_scan(in.begin(), in.end(), expect.begin(), id, compose());
+	my_STL::parallel_exclusive_scan(in.begin(), in.end(), got.begin(), id, compose(), 4);
+	bool ok = true;
+	for (size_t i = 0; i != in.size(); ++i)
+	{
+		ok = ok && same(expect[i], got[i]);
+	}
+	CHECK(ok);
+}
@@ -0,0 +1,106 @@
+#include <cstdio>
+#include <stdint.h>
+#include "test.h"
+#include "__Serialize.h"
+
+using my_STL::vector;
+using my_STL::list;
+
+namespace
+{
+	const char *path = "test_serialize.tmp";
+
+	//把文件截到bytes字节
+	void truncate_file(size_t bytes)
+	{
+		vector<char> buf;
+		std::FILE *f = std::fopen(path, "rb");
+		int c;
+		while (buf.size() < bytes && (c = std::fgetc(f)) != EOF)
+		{
+			buf.push_back(static_cast<char>(c));
+		}
+		std::fclose(f);
+		f = std::fopen(path, "wb");
+		std::fwrite(buf.begin(), 1, buf.size(), f);
+		std::fclose(f);
+	}
+
+	//改写偏移offset处的u64
+	void patch_u64(long offset, uint64_t x)
+	{
+		std::FILE *f = std::fopen(path, "r+b");
+		std::fseek(f, offset, SEEK_SET);
+		std::fwrite(&x, sizeof(x), 1, f);
+		std::fclose(f);
+	}
+
+	enum
+	{
+		__COUNT_OFFSET = 16,                   //文件头之后是顶层容器头，元素个数在最前
+		__NESTED_COUNT_OFFSET = 32             //顶层嵌套容器头之后是第一个子容器头
+	};
+}
+
+TEST_CASE(serialize_round_trip)
+{
+	vector<int> v;
+	for (int i = 0; i != 1000; ++i)
+	{
+		v.push_back(i);
+	}
+	CHECK(my_STL::serialize(path, v));
+	vector<int> w;
+	CHECK(my_STL::deserialize(path, w));
+	CHECK(w.size() == 1000 && w[999] == 999);
+	std::remove(path);
+}
+
+TEST_CASE(serialize_truncated_file_fails)
+{
+	vector<int> v(1000, 7);
+	CHECK(my_STL::serialize(path, v));
+	truncate_file(32 + 100);
+	vector<int> w(3, 1);
+	CHECK(!my_STL::deserialize(path, w));
+	CHECK(w.empty());
+	std::remove(path);
+}
+
+//个数为2^44而文件只有几个元素：不得照个数配置内存
+TEST_CASE(serialize_forged_count_fails)
+{
+	vector<int> v(4, 7);
+	CHECK(my_STL::serialize(path, v));
+	patch_u64(__COUNT_OFFSET, uint64_t(1) << 44);
+	vector<int> w;
+	CHECK(!my_STL::deserialize(path, w));
+	CHECK(w.empty());
+	patch_u64(__COUNT_OFFSET, ~uint64_t(0));
+	CHECK(!my_STL::deserialize(path, w));
+	list<int> l;
+	CHECK(!my_STL::deserialize(path, l));
+	CHECK(l.empty());
+	std::remove(path);
+}
+
+TEST_CASE(serialize_forged_nested_count_fails)
+{
+	vector<vector<int>> v;
+	v.push_back(vector<int>(3, 1));
+	v.push_back(vector<int>(2, 2));
+	CHECK(my_STL::serialize(path, v));
+	vector<vector<int>> w;
+	CHECK(my_STL::deserialize(path, w));
+	CHECK(w.size() == 2 && w[1].size() == 2 && w[1][1] == 2);
+
+	patch_u64(__COUNT_OFFSET, uint64_t(1) << 40);
+	CHECK(!my_STL::deserialize(path, w));
+	CHECK(w.empty());
+
+	patch_u64(__COUNT_OFFSET, 2);
+	patch_u64(__NESTED_COUNT_OFFSET, uint64_t(1) << 60);
+	CHECK(!my_STL::deserialize(path, w));
+	CHECK(w.empty());
+	std::remove(path);
+}
@@ -0,0 +1,122 @@
+#include <atomic>
+#include <thread>
+#include "test.h"
+#include "__Shared_vector.h"
+
+using my_STL::shared_vector;
+
+//读者反复取得并丢弃快照，写者同时追加并发布；最后一个引用常在读者线程中释放
+//版本与块的释放须不与写者的配置竞争，用-fsanitize=thread编译时不应报告数据竞争
+TEST_CASE(shared_vector_readers_drop_while_writer_appends)
+{
+	shared_vector<int> table;
+	std::atomic<bool> done(false);
+	std::atomic<int> bad(0);
+	const int rounds = 2000;
+
+	auto reader = [&] {
+		while (!done.load())
+		{
+			my_STL::vector_snapshot<int> s = table.snapshot();
+			for (size_t i = 0; i != s.size(); ++i)
+			{
+				if (s[i] != static_cast<int>(i))
+				{
+					++bad;
+				}
+			}
+		}
+	};
+	std::thread r1(reader), r2(reader), r3(reader);
+	for (int i = 0; i != rounds; ++i)
+	{
+		shared_vector<int>::writer w = table.edit();
+		w.push_back(i);
+		table.publish(std::move(w));
+	}
+	done.store(true);
+	r1.join();
+	r2.join();
+	r3.join();
+
+	CHECK(bad.load() == 0);
+	CHECK(table.snapshot().size() == static_cast<size_t>(rounds));
+	CHECK(table.snapshot()[rounds - 1] == rounds - 1);
+}
+
+namespace
+{
+	//统计存活的元素个数
+	struct counted
+	{
+		static std::atomic<int> live;
+		int x;
+
+		explicit counted(int v = 0) :x(v)
+		{
+			++live;
+		}
+
+		counted(const counted &c) :x(c.x)
+		{
+			++live;
+		}
+
+		counted &operator=(const counted &c)
+		{
+			x = c.x;
+			return *this;
+		}
+
+		~counted()
+		{
+			--live;
+		}
+	};
+
+	std::atomic<int> counted::live(0);
+}
+
+//读者不停地取快照，写者每次修改第0块后发布：被替换的版本须在发布时就回收，不能一直堆在那里
+TEST_CASE(shared_vector_reclaims_under_continuous_readers)
+{
+	const int n = 4 * my_STL::__SHARED_CHUNK;
+	{
+		shared_vector<counted> table;
+		{
+			shared_vector<counted>::writer w = table.edit();
+			for (int i = 0; i != n; ++i)
+			{
+				w.push_back(counted(i));
+			}
+			table.publish(std::move(w));
+		}
+		std::atomic<bool> done(false);
+		std::atomic<long long> sum(0);
+		auto reader = [&] {
+			while (!done.load())
+			{
+				my_STL::vector_snapshot<counted> s = table.snapshot();
+				sum += s[0].x;
+			}
+		};
+		std::thread r1(reader), r2(reader), r3(reader), r4(reader);
+		int peak = 0;
+		for (int i = 0; i != 2000; ++i)
+		{
+			shared_vector<counted>::writer w = table.edit();
+			w.set(0, counted(i));
+			table.publish(std::move(w));
+			const int live = counted::live.load();
+			peak = live > peak ? live : peak;
+		}
+		//当前版本n个，加上写者的出发版本与每个读者手中至多一个旧版本的第0块
+		CHECK(peak <= n + 5 * my_STL::__SHARED_CHUNK);
+		done.store(true);
+		r1.join();
+		r2.join();
+		r3.join();
+		r4.join();
+	}
+	CHECK(counted::live.load() == 0);
+}
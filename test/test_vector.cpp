@@ -0,0 +1,64 @@
+#include "test.h"
+#include "__Vector.h"
+
+using my_STL::vector;
+
+namespace
+{
+	struct counting_odd
+	{
+		int *calls;
+
+		bool operator()(int x) const
+		{
+			++*calls;
+			return x % 2 != 0;
+		}
+	};
+}
+
+TEST_CASE(vector_erase_if_calls_pred_once_per_element)
+{
+	vector<int> v;
+	for (int i = 0; i != 8; ++i)
+	{
+		v.push_back(i);
+	}
+	int calls = 0;
+	counting_odd pred = { &calls };
+	CHECK(my_STL::erase_if(v, pred) == 4);
+	CHECK(calls == 8);
+	CHECK(v.size() == 4);
+	CHECK(v[0] == 0 && v[1] == 2 && v[2] == 4 && v[3] == 6);
+}
+
+//有状态的谓词：清除第2、4、6……次调用遇到的元素
+TEST_CASE(vector_erase_if_stateful_pred)
+{
+	vector<int> v;
+	for (int i = 0; i != 10; ++i)
+	{
+		v.push_back(i);
+	}
+	int n = 0;
+	CHECK(my_STL::erase_if(v, [&n](int) { return ++n % 2 == 0; }) == 5);
+	CHECK(n == 10);
+	CHECK(v.size() == 5);
+	CHECK(v[0] == 0 && v[1] == 2 && v[4] == 8);
+}
+
+TEST_CASE(vector_erase_if_edges)
+{
+	vector<int> v;
+	int calls = 0;
+	counting_odd pred = { &calls };
+	CHECK(my_STL::erase_if(v, pred) == 0);
+	CHECK(calls == 0);
+	v.push_back(1);
+	v.push_back(3);
+	CHECK(my_STL::erase_if(v, pred) == 2);
+	CHECK(v.empty() && calls == 2);
+	v.push_back(2);
+	CHECK(my_STL::erase_if(v, pred) == 0);
+	CHECK(v.size() == 1);
+}